@@ -0,0 +1,47 @@
+#!/usr/bin/env bash
+# Per-module codegen emit time (lowering + printing a module's .hpp/.cpp text).
+# Reads the `emit <module>` rows of `mlcc --profile` for a synthetic single
+# module at growing scales, then for mlcc's own modules. Linear emit shows as
+# a flat ms-per-unit column.
+#
+# Usage: ./benchmarks/emit/run_emit_bench.sh [suite] [scales...]
+# Example: ./benchmarks/emit/run_emit_bench.sh functions 500 1000 2000 4000
+
+set -e
+ROOT="$(cd "$(dirname "$0")/../.." && pwd)"
+MLCC="$ROOT/compiler/out/mlcc"
+GEN="$ROOT/benchmarks/synthetic/gen.rb"
+
+if [ ! -x "$MLCC" ]; then
+  echo "mlcc missing: $MLCC (run compiler/build.sh first)" >&2
+  exit 1
+fi
+
+SUITE="${1:-functions}"
+shift || true
+SCALES="${*:-500 1000 2000 4000}"
+
+emit_rows() {
+  grep -E '^emit ' "$1" || true
+}
+
+printf "%-10s %8s %12s %14s\n" "suite" "scale" "emit(ms)" "us/unit"
+printf "%-10s %8s %12s %14s\n" "----------" "--------" "------------" "--------------"
+
+for SCALE in $SCALES; do
+  GEN_DIR="$(mktemp -d /tmp/emit_gen_XXXX)"
+  OUT_DIR="$(mktemp -d /tmp/emit_out_XXXX)"
+  ruby "$GEN" "$SUITE" "$SCALE" "$GEN_DIR" > /dev/null
+  "$MLCC" --profile -o "$OUT_DIR" "$GEN_DIR/main.mlc" 2> "$OUT_DIR/profile.txt" > /dev/null
+  EMIT_MS="$(emit_rows "$OUT_DIR/profile.txt" | awk '{ total += $(NF - 3) } END { printf "%.2f", total }')"
+  PER_UNIT="$(echo "scale=2; $EMIT_MS * 1000 / $SCALE" | bc 2>/dev/null || echo "?")"
+  printf "%-10s %8d %12s %14s\n" "$SUITE" "$SCALE" "$EMIT_MS" "$PER_UNIT"
+  rm -rf "$GEN_DIR" "$OUT_DIR"
+done
+
+echo ""
+echo "=== mlcc self-emit: slowest modules ==="
+SELF_OUT="$(mktemp -d /tmp/emit_self_XXXX)"
+"$MLCC" --profile -o "$SELF_OUT" "$ROOT/compiler/main.mlc" 2> "$SELF_OUT/profile.txt" > /dev/null
+emit_rows "$SELF_OUT/profile.txt" | head -20
+rm -rf "$SELF_OUT"
@@ -0,0 +1,50 @@
+#!/usr/bin/env bash
+# Script VM bytecode micro-benchmarks (loops, calls, closures, recursion).
+#
+# Usage:
+#   ./benchmarks/script_vm/run_bytecode_bench.sh
+#   BASELINE_REF=HEAD~1 ./benchmarks/script_vm/run_bytecode_bench.sh
+#
+# BASELINE_REF runs the same cases against script_vm/ from that git ref
+# (temporary worktree) first and prints it as "before", the working tree as "after".
+
+set -euo pipefail
+ROOT="$(cd "$(dirname "$0")/../.." && pwd)"
+MLCC="${MLCC:-$ROOT/compiler/out/mlcc}"
+BENCH_SOURCE="$ROOT/benchmarks/script_vm/bytecode_bench.mlc"
+OUT="${SCRIPT_VM_BENCH_OUT:-$ROOT/.tmp_script_vm_bench}"
+
+if [ ! -x "$MLCC" ]; then
+  echo "mlcc missing: $MLCC (run compiler/build.sh first)" >&2
+  exit 1
+fi
+
+export TMPDIR="${TMPDIR:-$ROOT/tmp}"
+export MLCC_PCH="${MLCC_PCH:-0}"
+mkdir -p "$TMPDIR"
+
+run_bench() {
+  local name="$1"
+  local label="$2"
+  local tree="$3"
+  local out_dir="$OUT/$name"
+  rm -rf "$out_dir"
+  mkdir -p "$out_dir"
+  "$MLCC" -o "$out_dir" "$tree/benchmarks/script_vm/bytecode_bench.mlc"
+  "$ROOT/compiler/build_bin.sh" "$out_dir" "$out_dir/bin" >/dev/null
+  echo "=== $label ==="
+  "$out_dir/bin"
+}
+
+if [ -n "${BASELINE_REF:-}" ]; then
+  baseline_tree="$(mktemp -d "$TMPDIR/script_vm_bench_XXXX")"
+  trap 'git -C "$ROOT" worktree remove --force "$baseline_tree" >/dev/null 2>&1 || true' EXIT
+  git -C "$ROOT" worktree add --detach "$baseline_tree" "$BASELINE_REF" >/dev/null
+  mkdir -p "$baseline_tree/benchmarks/script_vm"
+  cp "$BENCH_SOURCE" "$baseline_tree/benchmarks/script_vm/bytecode_bench.mlc"
+  run_bench before "before ($BASELINE_REF)" "$baseline_tree"
+  echo ""
+  run_bench after "after" "$ROOT"
+else
+  run_bench current "current" "$ROOT"
+fi
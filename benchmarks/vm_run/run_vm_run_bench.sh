@@ -0,0 +1,88 @@
+#!/usr/bin/env bash
+# `mlcc --run` wall time over the e2e fixtures (MIR interpreter, no g++).
+#
+# Usage:
+#   ./benchmarks/vm_run/run_vm_run_bench.sh [fixture.mlc ...]
+#   RUNS=10 ./benchmarks/vm_run/run_vm_run_bench.sh
+#   MLCC_BASELINE=/path/to/old/mlcc ./benchmarks/vm_run/run_vm_run_bench.sh
+#
+# Default fixtures: compiler/tests/e2e/*.mlc. Each fixture runs RUNS times per
+# compiler; the median is printed in ms. Fixtures the VM rejects (non-zero
+# exit with a `vm:` error) are listed as "skip". With MLCC_BASELINE set, that
+# binary is timed as "before" and MLCC as "after".
+
+set -euo pipefail
+ROOT="$(cd "$(dirname "$0")/../.." && pwd)"
+MLCC="${MLCC:-$ROOT/compiler/out/mlcc}"
+RUNS="${RUNS:-5}"
+
+if [ ! -x "$MLCC" ]; then
+  echo "mlcc missing: $MLCC (run compiler/build.sh first)" >&2
+  exit 1
+fi
+if [ -n "${MLCC_BASELINE:-}" ] && [ ! -x "$MLCC_BASELINE" ]; then
+  echo "baseline mlcc missing: $MLCC_BASELINE" >&2
+  exit 1
+fi
+
+if [ "$#" -gt 0 ]; then
+  FIXTURES=("$@")
+else
+  FIXTURES=("$ROOT"/compiler/tests/e2e/*.mlc)
+fi
+
+# Median wall time in ms of RUNS `--run` invocations; "skip" when the VM fails.
+median_run_ms() {
+  local compiler="$1"
+  local fixture="$2"
+  local samples=()
+  local run
+  for ((run = 0; run < RUNS; run++)); do
+    local started ended
+    started=$(date +%s%N)
+    if "$compiler" --run "$fixture" >/dev/null 2>"$TMP_ERR"; then
+      :
+    elif grep -q 'vm:' "$TMP_ERR"; then
+      echo "skip"
+      return
+    fi
+    ended=$(date +%s%N)
+    samples+=($(( (ended - started) / 1000000 )))
+  done
+  printf '%s\n' "${samples[@]}" | sort -n | sed -n "$(( (RUNS + 1) / 2 ))p"
+}
+
+TMP_ERR="$(mktemp "${TMPDIR:-/tmp}/vm_run_bench_XXXX")"
+trap 'rm -f "$TMP_ERR"' EXIT
+
+if [ -n "${MLCC_BASELINE:-}" ]; then
+  printf "%-32s %10s %10s\n" "fixture" "before(ms)" "after(ms)"
+else
+  printf "%-32s %10s\n" "fixture" "run(ms)"
+fi
+
+total_after=0
+total_before=0
+for fixture in "${FIXTURES[@]}"; do
+  name="$(basename "$fixture" .mlc)"
+  after="$(median_run_ms "$MLCC" "$fixture")"
+  if [ -n "${MLCC_BASELINE:-}" ]; then
+    before="$(median_run_ms "$MLCC_BASELINE" "$fixture")"
+    printf "%-32s %10s %10s\n" "$name" "$before" "$after"
+    if [ "$before" != "skip" ] && [ "$after" != "skip" ]; then
+      total_before=$((total_before + before))
+      total_after=$((total_after + after))
+    fi
+  else
+    printf "%-32s %10s\n" "$name" "$after"
+    if [ "$after" != "skip" ]; then
+      total_after=$((total_after + after))
+    fi
+  fi
+done
+
+if [ -n "${MLCC_BASELINE:-}" ]; then
+  printf "%-32s %10s %10s\n" "total" "$total_before" "$total_after"
+else
+  printf "%-32s %10s\n" "total" "$total_after"
+fi
@@ -0,0 +1,76 @@
+#!/usr/bin/env bash
+# `mlcc --run` (MIR interpreter) vs the compiled C++ binary on map- and call-heavy fixtures.
+#
+# Usage:
+#   ./benchmarks/vm_run/run_vm_vs_native_bench.sh [fixture.mlc ...]
+#   RUNS=10 ./benchmarks/vm_run/run_vm_vs_native_bench.sh
+#
+# Default fixtures: misc/examples/vm_map.mlc, vm_map_heavy.mlc, vm_fib_calls.mlc.
+# Prints the median wall time in ms of RUNS runs for each side. The native
+# binary is built once per fixture (not timed); exit codes must match.
+
+set -euo pipefail
+ROOT="$(cd "$(dirname "$0")/../.." && pwd)"
+MLCC="${MLCC:-$ROOT/compiler/out/mlcc}"
+RUNS="${RUNS:-5}"
+
+if [ ! -x "$MLCC" ]; then
+  echo "mlcc missing: $MLCC (run compiler/build.sh first)" >&2
+  exit 1
+fi
+
+if [ "$#" -gt 0 ]; then
+  FIXTURES=("$@")
+else
+  FIXTURES=(
+    "$ROOT/misc/examples/vm_map.mlc"
+    "$ROOT/misc/examples/vm_map_heavy.mlc"
+    "$ROOT/misc/examples/vm_fib_calls.mlc"
+  )
+fi
+
+export TMPDIR="${TMPDIR:-$ROOT/tmp}"
+mkdir -p "$TMPDIR"
+WORK="$(mktemp -d "$TMPDIR/vm_vs_native_XXXX")"
+trap 'rm -rf "$WORK"' EXIT
+
+# Sets MEDIAN_MS (median of RUNS invocations of "$@") and LAST_EXIT.
+median_ms() {
+  local samples=()
+  local run
+  for ((run = 0; run < RUNS; run++)); do
+    local started ended
+    started=$(date +%s%N)
+    set +e
+    "$@" >/dev/null 2>&1
+    LAST_EXIT=$?
+    set -e
+    ended=$(date +%s%N)
+    samples+=($(( (ended - started) / 1000000 )))
+  done
+  MEDIAN_MS="$(printf '%s\n' "${samples[@]}" | sort -n | sed -n "$(( (RUNS + 1) / 2 ))p")"
+}
+
+printf "%-24s %10s %12s %8s\n" "fixture" "vm(ms)" "native(ms)" "exit"
+status=0
+for fixture in "${FIXTURES[@]}"; do
+  name="$(basename "$fixture" .mlc)"
+  build_dir="$WORK/$name"
+  mkdir -p "$build_dir"
+  "$MLCC" -o "$build_dir" "$fixture" >/dev/null
+  MLCC_ENTRY_BASENAME="$name" "$ROOT/compiler/build_bin.sh" "$build_dir" "$build_dir/program" >/dev/null
+
+  median_ms "$MLCC" --run "$fixture"
+  vm_ms=$MEDIAN_MS
+  vm_exit=$LAST_EXIT
+  median_ms "$build_dir/program"
+  native_ms=$MEDIAN_MS
+  native_exit=$LAST_EXIT
+  exit_column="$vm_exit"
+  if [ "$vm_exit" -ne "$native_exit" ]; then
+    exit_column="$vm_exit!=$native_exit"
+    status=1
+  fi
+  printf "%-24s %10s %12s %8s\n" "$name" "$vm_ms" "$native_ms" "$exit_column"
+done
+exit "$status"
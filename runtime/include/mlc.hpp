@@ -18,8 +18,10 @@
 // Core types
 #include "mlc/core/symbol.hpp"
 #include "mlc/core/string.hpp"
+#include "mlc/core/string_builder.hpp"
 #include "mlc/core/array.hpp"
 #include "mlc/core/hashmap.hpp"
+#include "mlc/core/persistent_map.hpp"
 #include "mlc/core/collections.hpp"
 #include "mlc/core/match.hpp"
 #include "mlc/core/option.hpp"
@@ -27,6 +29,7 @@
 #include "mlc/core/result.hpp"
 #include "mlc/core/result_combinators.hpp"
 #include "mlc/core/task.hpp"
+#include "mlc/core/shared_node.hpp"
 #include "mlc/core/profile.hpp"
 #include "mlc/concurrency/channel.hpp"
 #include "mlc/concurrency/spawn.hpp"
@@ -3,11 +3,16 @@
 // Bounded / rendezvous / unbounded channel + Sender/Receiver split
 // (TRACK_CONCURRENCY_V2 STEP=2–3; TRACK_CONCURRENCY_CHANNEL_RENDEZVOUS_UNBOUNDED).
 // Cancel wake (TRACK_CONCURRENCY_TASKSCOPE STEP=1): send/receive(StopToken) → ChannelStatus.
-// capacity >= 1: buffered; capacity 0: synchronous handoff;
-// make_unbounded_channel: capacity == SIZE_MAX (never blocks on full).
+// capacity >= 1: buffered, lock-free MPMC ring (mpmc_ring.hpp);
+// capacity 0: synchronous handoff; make_unbounded_channel: capacity == SIZE_MAX
+// (never blocks on full). The last two use the mutex + deque below.
 // Last Sender drop (or Sender::close) marks closed and wakes waiters.
+// send_many / receive_many(max) move a batch per lock acquisition (ring: per
+// CAS) and per wakeup.
 
+#include "mlc/concurrency/mpmc_ring.hpp"
 #include "mlc/concurrency/stop.hpp"
+#include "mlc/core/array.hpp"
 
 #include <condition_variable>
 #include <cstddef>
@@ -53,7 +58,10 @@ struct ChannelState {
         : capacity(capacity_value)
         , closed(false)
         , waiting_receivers(0)
-        , sender_count(0) {}
+        , sender_count(0) {
+        if (capacity >= 1 && capacity != std::numeric_limits<size_t>::max())
+            ring = std::make_unique<MpmcRing<Value>>(capacity);
+    }
 
     std::mutex mutex;
     std::condition_variable not_empty;
@@ -64,10 +72,19 @@ struct ChannelState {
     bool closed;
     size_t waiting_receivers;
     size_t sender_count;
+    // Bounded buffered channels: values live here, `queue` stays empty and the
+    // mutex only guards `closed` / sender bookkeeping.
+    std::unique_ptr<MpmcRing<Value>> ring;
+
+    void mark_closed_locked() {
+        closed = true;
+        if (ring) ring->close();
+    }
 
-    void mark_closed_locked() { closed = true; }
+    size_t size_locked() const { return ring ? ring->size() : queue.size(); }
 
     void wake_all() {
+        if (ring) ring->wake_all();
         not_empty.notify_all();
         not_full.notify_all();
         handoff_done.notify_all();
@@ -76,6 +93,7 @@ struct ChannelState {
 
 template<typename Value>
 bool channel_send(std::shared_ptr<ChannelState<Value>> state, Value value) {
+    if (state->ring) return state->ring->push(std::move(value), [] { return false; }) == RingPush::Ok;
     if (state->capacity == 0) {
         std::unique_lock<std::mutex> lock(state->mutex);
         state->not_full.wait(lock, [&] {
@@ -113,6 +131,12 @@ ChannelStatus channel_send_cancellable(
     const StopToken& stop_token
 ) {
     std::stop_callback wake(stop_token.native_token(), [state] { state->wake_all(); });
+    if (state->ring) {
+        if (stop_token.requested()) return ChannelStatus::Cancelled;
+        const RingPush pushed = state->ring->push(std::move(value), [&] { return stop_token.requested(); });
+        if (pushed == RingPush::Ok) return ChannelStatus::Ok;
+        return stop_token.requested() ? ChannelStatus::Cancelled : ChannelStatus::Closed;
+    }
     if (state->capacity == 0) {
         std::unique_lock<std::mutex> lock(state->mutex);
         state->not_full.wait(lock, [&] {
@@ -151,6 +175,7 @@ ChannelStatus channel_send_cancellable(
 
 template<typename Value>
 bool channel_try_send(std::shared_ptr<ChannelState<Value>> state, const Value& value) {
+    if (state->ring) return state->ring->try_push(value) == RingPush::Ok;
     std::lock_guard<std::mutex> lock(state->mutex);
     if (state->closed) return false;
     if (state->capacity == 0) {
@@ -167,6 +192,11 @@ bool channel_try_send(std::shared_ptr<ChannelState<Value>> state, const Value& v
 
 template<typename Value>
 std::optional<Value> channel_receive(std::shared_ptr<ChannelState<Value>> state) {
+    if (state->ring) {
+        std::optional<Value> value;
+        state->ring->pop(value, [] { return false; });
+        return value;
+    }
     if (state->capacity == 0) {
         std::unique_lock<std::mutex> lock(state->mutex);
         state->waiting_receivers += 1;
@@ -200,6 +230,13 @@ ChannelReceiveResult<Value> channel_receive_cancellable(
     const StopToken& stop_token
 ) {
     std::stop_callback wake(stop_token.native_token(), [state] { state->wake_all(); });
+    if (state->ring) {
+        std::optional<Value> value;
+        if (state->ring->pop(value, [&] { return stop_token.requested(); }) == RingPop::Ok)
+            return ChannelReceiveResult<Value>{ChannelStatus::Ok, std::move(value)};
+        const ChannelStatus status = stop_token.requested() ? ChannelStatus::Cancelled : ChannelStatus::Closed;
+        return ChannelReceiveResult<Value>{status, std::nullopt};
+    }
     if (state->capacity == 0) {
         std::unique_lock<std::mutex> lock(state->mutex);
         state->waiting_receivers += 1;
@@ -239,6 +276,11 @@ ChannelReceiveResult<Value> channel_receive_cancellable(
 
 template<typename Value>
 std::optional<Value> channel_try_receive(std::shared_ptr<ChannelState<Value>> state) {
+    if (state->ring) {
+        std::optional<Value> value;
+        state->ring->try_pop(value);
+        return value;
+    }
     std::unique_lock<std::mutex> lock(state->mutex);
     if (state->queue.empty()) return std::nullopt;
     Value value = std::move(state->queue.front());
@@ -253,6 +295,67 @@ std::optional<Value> channel_try_receive(std::shared_ptr<ChannelState<Value>> st
     return value;
 }
 
+// Sends values in order, blocking while full; stops at close. Returns how many
+// were delivered.
+template<typename Value, typename Values>
+size_t channel_send_many(std::shared_ptr<ChannelState<Value>> state, const Values& values) {
+    if (state->ring) return state->ring->push_all(std::begin(values), std::end(values));
+    size_t sent = 0;
+    if (state->capacity == 0) {
+        for (const auto& value : values) {
+            if (!channel_send(state, Value(value))) break;
+            ++sent;
+        }
+        return sent;
+    }
+    auto next = std::begin(values);
+    const auto last = std::end(values);
+    std::unique_lock<std::mutex> lock(state->mutex);
+    while (next != last) {
+        state->not_full.wait(lock, [&] {
+            return state->closed || state->queue.size() < state->capacity;
+        });
+        if (state->closed) break;
+        size_t batch = 0;
+        for (; next != last && state->queue.size() < state->capacity; ++next, ++batch)
+            state->queue.push_back(*next);
+        sent += batch;
+        lock.unlock();
+        if (batch == 1) state->not_empty.notify_one();
+        else state->not_empty.notify_all();
+        lock.lock();
+    }
+    return sent;
+}
+
+// Blocks for the first value, then takes whatever else is queued, up to
+// `max_count`. Empty result: closed and drained (or max_count == 0).
+template<typename Value>
+mlc::Array<Value> channel_receive_many(std::shared_ptr<ChannelState<Value>> state, size_t max_count) {
+    mlc::Array<Value> values;
+    if (max_count == 0) return values;
+    if (state->ring) {
+        state->ring->pop_batch(values, max_count);
+        return values;
+    }
+    if (state->capacity == 0) {
+        if (auto value = channel_receive(state)) values.push_back(std::move(*value));
+        return values;
+    }
+    std::unique_lock<std::mutex> lock(state->mutex);
+    state->not_empty.wait(lock, [&] {
+        return state->closed || !state->queue.empty();
+    });
+    while (!state->queue.empty() && values.size() < max_count) {
+        values.push_back(std::move(state->queue.front()));
+        state->queue.pop_front();
+    }
+    lock.unlock();
+    if (values.size() == 1) state->not_full.notify_one();
+    else if (values.size() > 1) state->not_full.notify_all();
+    return values;
+}
+
 } // namespace detail
 
 template<typename Value>
@@ -374,6 +477,12 @@ public:
         if (!state_) return false;
         return detail::channel_try_send(state_, value);
     }
+
+    template<typename Values>
+    size_t send_many(const Values& values) {
+        if (!state_) return 0;
+        return detail::channel_send_many(state_, values);
+    }
 };
 
 template<typename Value>
@@ -408,7 +517,7 @@ public:
     size_t size() const {
         if (!state_) return 0;
         std::lock_guard<std::mutex> lock(state_->mutex);
-        return state_->queue.size();
+        return state_->size_locked();
     }
 
     std::optional<Value> receive() {
@@ -425,6 +534,11 @@ public:
         if (!state_) return std::nullopt;
         return detail::channel_try_receive(state_);
     }
+
+    mlc::Array<Value> receive_many(size_t max_count) {
+        if (!state_) return mlc::Array<Value>();
+        return detail::channel_receive_many(state_, max_count);
+    }
 };
 
 struct UnboundedChannelTag {};
@@ -458,7 +572,7 @@ public:
 
     size_t size() const {
         std::lock_guard<std::mutex> lock(state_->mutex);
-        return state_->queue.size();
+        return state_->size_locked();
     }
 
     void close() {
@@ -483,6 +597,11 @@ public:
     }
     bool try_send(const Value& value) { return detail::channel_try_send(state_, value); }
     std::optional<Value> try_receive() { return detail::channel_try_receive(state_); }
+    template<typename Values>
+    size_t send_many(const Values& values) { return detail::channel_send_many(state_, values); }
+    mlc::Array<Value> receive_many(size_t max_count) {
+        return detail::channel_receive_many(state_, max_count);
+    }
 
     Sender<Value> sender() { return Sender<Value>(state_, true); }
     Receiver<Value> receiver() { return Receiver<Value>(state_); }
@@ -0,0 +1,23 @@
+#pragma once
+
+// Monotonic milliseconds and sleep for polling loops (CONCURRENCY_V2 §23).
+// monotonic_millis counts from the first call in the process, so it fits an
+// i32 for ~24 days; compare readings by difference, never against wall time.
+
+#include <chrono>
+#include <cstdint>
+#include <thread>
+
+namespace mlc::concurrency {
+
+inline int32_t monotonic_millis() {
+    static const auto epoch = std::chrono::steady_clock::now();
+    return static_cast<int32_t>(
+        std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - epoch).count());
+}
+
+inline void sleep_ms(int32_t milliseconds) {
+    if (milliseconds > 0) std::this_thread::sleep_for(std::chrono::milliseconds(milliseconds));
+}
+
+} // namespace mlc::concurrency
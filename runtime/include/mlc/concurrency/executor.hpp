@@ -0,0 +1,88 @@
+#pragma once
+
+// Shared runtime executor behind spawn_task and TaskScope::spawn.
+// Started lazily on first use: a WorkStealing ThreadPool with one worker per
+// hardware thread, an unbounded injection queue (spawn never blocks) and
+// elastic growth up to kRuntimeExecutorMaxWorkers when every worker is
+// blocked. Never destroyed: callers join their work (Task / TaskScope), and
+// workers must not outlive statics they might touch during exit.
+//
+// ForkedJob: one spawned callable, claimable exactly once. The pool job and
+// the joiner race to claim it; a joiner that wins runs it inline, so waiting
+// on a child that no worker has picked up yet never blocks a thread.
+
+#include "mlc/concurrency/thread_pool.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <future>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace mlc::concurrency {
+
+inline constexpr std::size_t kRuntimeExecutorMaxWorkers = 512;
+
+inline ThreadPool& runtime_executor() {
+    static ThreadPool* const executor = new ThreadPool(
+        static_cast<std::size_t>(default_worker_count()), UnboundedChannelTag{},
+        PoolScheduling::WorkStealing, kRuntimeExecutorMaxWorkers);
+    return *executor;
+}
+
+namespace detail {
+
+template<typename Result>
+class ForkedJob {
+    std::packaged_task<Result()> work_;
+    std::future<Result> future_;
+    std::atomic<bool> claimed_{false};
+    std::atomic<bool> finished_{false};
+
+public:
+    template<typename Callable>
+    explicit ForkedJob(Callable&& callable)
+        : work_(std::forward<Callable>(callable)), future_(work_.get_future()) {}
+
+    ForkedJob(const ForkedJob&) = delete;
+    ForkedJob& operator=(const ForkedJob&) = delete;
+
+    // Runs the callable unless another thread already claimed it.
+    bool try_run() {
+        if (claimed_.exchange(true, std::memory_order_acq_rel)) return false;
+        work_();
+        finished_.store(true, std::memory_order_release);
+        return true;
+    }
+
+    // Set once the callable has returned or thrown; get() then does not block.
+    const std::atomic<bool>& finished() const noexcept { return finished_; }
+
+    // Waits for the result, running the callable here if nobody started it.
+    void wait() {
+        if (!try_run()) future_.wait();
+    }
+
+    // Rethrows an exception thrown by the callable. Call once.
+    Result get() {
+        wait();
+        return future_.get();
+    }
+};
+
+// Submit `callable` to `pool`; a job the pool refuses (shut down / cancelled)
+// stays unclaimed and runs inline when joined.
+template<typename Callable>
+auto fork_job(ThreadPool& pool, Callable&& callable)
+    -> std::shared_ptr<ForkedJob<std::invoke_result_t<std::decay_t<Callable>>>> {
+    using Decayed = std::decay_t<Callable>;
+    using Result = std::invoke_result_t<Decayed>;
+    auto job = std::make_shared<ForkedJob<Result>>(Decayed(std::forward<Callable>(callable)));
+    pool.submit([job] { job->try_run(); });
+    return job;
+}
+
+} // namespace detail
+
+} // namespace mlc::concurrency
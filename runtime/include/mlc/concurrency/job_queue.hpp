@@ -3,6 +3,7 @@
 // In-process job queue on ThreadPool (TRACK_STDLIB_JOB_QUEUE STEP=2).
 // enqueue / schedule_after / wait_idle / shutdown; fixed max_attempts retry.
 // Timer thread for delays (does not block pool workers with sleep).
+// Optional PoolScheduling selects the ThreadPool mode (default SharedQueue).
 
 #include "mlc/concurrency/thread_pool.hpp"
 
@@ -115,8 +116,9 @@ public:
   JobQueue(
       std::size_t worker_count,
       std::size_t queue_capacity,
-      std::size_t max_attempts = 1)
-      : pool_(worker_count, queue_capacity),
+      std::size_t max_attempts = 1,
+      PoolScheduling scheduling = PoolScheduling::SharedQueue)
+      : pool_(worker_count, queue_capacity, scheduling),
         max_attempts_(max_attempts == 0 ? 1 : max_attempts) {
     timer_thread_ = std::thread([this] { timer_loop(); });
   }
@@ -0,0 +1,377 @@
+#pragma once
+
+// Bounded lock-free MPMC ring (Vyukov sequence cells) with spin-then-park waits.
+// Backs Channel<T> for 1 <= capacity <= 1048576; rendezvous and unbounded
+// channels keep the mutex/deque path in channel.hpp.
+//
+// Positions are stamps: the cell index in the low bits and the lap above them,
+// one lap being the capacity rounded up to a power of two. Going from the last
+// cell to the next lap skips the unused indices, so the capacity stays exact
+// and finding a cell is a mask, not a division.
+//
+// Each cell carries a sequence number: `2 * stamp` means free for the
+// producer of that stamp, `2 * stamp + 1` full for the matching consumer
+// (doubled so the two never coincide, even with a single cell). tail_
+// holds the next producer stamp shifted left by one, with bit 0 set once
+// the ring is closed, so a producer can never claim a slot after close() and
+// a consumer that sees head == tail on a closed ring knows no value is still
+// on its way. A slot claimed but not yet written shows head != tail; consumers
+// wait for it instead of reporting empty.
+//
+// Cells store their sequence relative to the first-lap stamp, so a new ring is
+// all zero bytes: it comes from calloc, and the OS commits its pages as the
+// stamps first reach them rather than when the channel is made.
+//
+// Blocking: callers spin briefly, then park on an epoch counter with
+// std::atomic::wait (a futex on Linux). Producers bump items_epoch_ after each
+// push, consumers bump space_epoch_ after each pop (once per batch for the
+// *_batch calls); notify is only issued when a parked waiter is registered, so
+// the uncontended path makes no syscalls.
+
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+namespace mlc::concurrency::detail {
+
+enum class RingPush { Ok, Full, Closed };
+enum class RingPop { Ok, Empty, Closed };
+
+inline void ring_cpu_relax() noexcept {
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__)
+    asm volatile("yield" ::: "memory");
+#else
+    std::this_thread::yield();
+#endif
+}
+
+template<typename Value>
+class MpmcRing {
+    static constexpr size_t kCacheLine = 64;
+    static constexpr int kSpinLimit = 64;
+
+    // Plain bytes so that zeroed memory is a valid ring; `sequence` is only
+    // touched through std::atomic_ref.
+    struct Cell {
+        alignas(std::atomic_ref<uint64_t>::required_alignment) uint64_t sequence;
+        alignas(Value) unsigned char storage[sizeof(Value)];
+
+        Value* value() noexcept { return std::launder(reinterpret_cast<Value*>(storage)); }
+    };
+
+    struct CellsDeleter {
+        void operator()(Cell* cells) const noexcept {
+            if constexpr (alignof(Cell) > alignof(std::max_align_t))
+                ::operator delete[](cells, std::align_val_t(alignof(Cell)));
+            else
+                std::free(cells);
+        }
+    };
+
+    static Cell* allocate_cells(size_t count) {
+        if constexpr (alignof(Cell) > alignof(std::max_align_t)) {
+            void* memory = ::operator new[](count * sizeof(Cell), std::align_val_t(alignof(Cell)));
+            std::memset(memory, 0, count * sizeof(Cell));
+            return static_cast<Cell*>(memory);
+        } else {
+            void* memory = std::calloc(count, sizeof(Cell));
+            if (!memory) throw std::bad_alloc();
+            return static_cast<Cell*>(memory);
+        }
+    }
+
+    const size_t capacity_;
+    const uint64_t one_lap_;
+    const uint64_t index_mask_;
+    const int lap_shift_;
+    std::unique_ptr<Cell[], CellsDeleter> cells_;
+    alignas(kCacheLine) std::atomic<uint64_t> head_{0};
+    alignas(kCacheLine) std::atomic<uint64_t> tail_{0};
+    alignas(kCacheLine) std::atomic<uint32_t> items_epoch_{0};
+    std::atomic<uint32_t> parked_consumers_{0};
+    alignas(kCacheLine) std::atomic<uint32_t> space_epoch_{0};
+    std::atomic<uint32_t> parked_producers_{0};
+
+    static constexpr uint64_t kClosedBit = 1;
+
+    Cell& cell_at(uint64_t stamp) noexcept { return cells_[stamp & index_mask_]; }
+
+    // The stamp `count` cells after `stamp`; count <= capacity_, so at most one
+    // lap boundary is crossed.
+    uint64_t advance(uint64_t stamp, size_t count) const noexcept {
+        const uint64_t index = (stamp & index_mask_) + count;
+        if (index < capacity_) return stamp + count;
+        return (stamp & ~index_mask_) + one_lap_ + (index - capacity_);
+    }
+
+    uint64_t sequence_of(uint64_t stamp, std::memory_order order) noexcept {
+        const uint64_t index = stamp & index_mask_;
+        return std::atomic_ref<uint64_t>(cells_[index].sequence).load(order) + 2 * index;
+    }
+
+    void publish(uint64_t stamp, uint64_t sequence) noexcept {
+        const uint64_t index = stamp & index_mask_;
+        std::atomic_ref<uint64_t>(cells_[index].sequence).store(sequence - 2 * index, std::memory_order_release);
+    }
+
+    // Parked waiters register in `parked` and never unregister themselves; each
+    // wake takes one registration, so a burst of pushes while the only
+    // consumer is still waking issues one futex wake, not one per push.
+    // A batch of `count` values takes up to `count` registrations.
+    static void signal(std::atomic<uint32_t>& epoch, std::atomic<uint32_t>& parked, size_t count = 1) noexcept {
+        epoch.fetch_add(1, std::memory_order_seq_cst);
+        uint32_t registered = parked.load(std::memory_order_seq_cst);
+        uint32_t taken = 0;
+        do {
+            taken = registered < count ? registered : static_cast<uint32_t>(count);
+        } while (taken != 0
+                 && !parked.compare_exchange_weak(registered, registered - taken, std::memory_order_seq_cst));
+        if (taken == 1) epoch.notify_one();
+        else if (taken > 1) epoch.notify_all();
+    }
+
+    template<typename Attempt, typename ShouldStop>
+    static auto park_until(std::atomic<uint32_t>& epoch, std::atomic<uint32_t>& parked,
+                           Attempt&& attempt, ShouldStop&& should_stop) {
+        for (int spin = 0;; ++spin) {
+            const uint32_t observed = epoch.load(std::memory_order_seq_cst);
+            if (spin >= kSpinLimit) parked.fetch_add(1, std::memory_order_seq_cst);
+            if (auto result = attempt()) return result;
+            if (should_stop()) return decltype(attempt())();
+            if (spin < kSpinLimit) ring_cpu_relax();
+            else epoch.wait(observed, std::memory_order_seq_cst);
+        }
+    }
+
+public:
+    explicit MpmcRing(size_t capacity)
+        : capacity_(capacity),
+          one_lap_(std::bit_ceil(static_cast<uint64_t>(capacity))),
+          index_mask_(one_lap_ - 1),
+          lap_shift_(std::countr_zero(one_lap_)),
+          cells_(allocate_cells(capacity)) {}
+
+    MpmcRing(const MpmcRing&) = delete;
+    MpmcRing& operator=(const MpmcRing&) = delete;
+
+    ~MpmcRing() {
+        uint64_t head = head_.load(std::memory_order_relaxed);
+        const uint64_t tail = tail_.load(std::memory_order_relaxed) >> 1;
+        for (; head != tail; head = advance(head, 1)) cell_at(head).value()->~Value();
+    }
+
+    size_t capacity() const noexcept { return capacity_; }
+
+    bool closed() const noexcept { return (tail_.load(std::memory_order_acquire) & kClosedBit) != 0; }
+
+    size_t size() const noexcept {
+        const uint64_t tail = tail_.load(std::memory_order_acquire) >> 1;
+        const uint64_t head = head_.load(std::memory_order_acquire);
+        if (tail <= head) return 0;
+        const uint64_t laps = (tail >> lap_shift_) - (head >> lap_shift_);
+        return static_cast<size_t>(laps * capacity_ + (tail & index_mask_) - (head & index_mask_));
+    }
+
+    // Returns true if this call closed the ring.
+    bool close() noexcept {
+        const bool newly_closed = (tail_.fetch_or(kClosedBit, std::memory_order_acq_rel) & kClosedBit) == 0;
+        wake_all();
+        return newly_closed;
+    }
+
+    void wake_all() noexcept {
+        items_epoch_.fetch_add(1, std::memory_order_seq_cst);
+        space_epoch_.fetch_add(1, std::memory_order_seq_cst);
+        parked_consumers_.store(0, std::memory_order_seq_cst);
+        parked_producers_.store(0, std::memory_order_seq_cst);
+        items_epoch_.notify_all();
+        space_epoch_.notify_all();
+    }
+
+    template<typename Argument>
+    RingPush try_push(Argument&& argument) {
+        uint64_t tail = tail_.load(std::memory_order_relaxed);
+        while (true) {
+            if (tail & kClosedBit) return RingPush::Closed;
+            const uint64_t position = tail >> 1;
+            const uint64_t sequence = sequence_of(position, std::memory_order_acquire);
+            const auto difference = static_cast<int64_t>(sequence - 2 * position);
+            if (difference == 0) {
+                if (tail_.compare_exchange_weak(tail, advance(position, 1) << 1, std::memory_order_relaxed)) {
+                    ::new (static_cast<void*>(cell_at(position).storage)) Value(std::forward<Argument>(argument));
+                    publish(position, 2 * position + 1);
+                    signal(items_epoch_, parked_consumers_);
+                    return RingPush::Ok;
+                }
+            } else if (difference < 0) {
+                return RingPush::Full;
+            } else {
+                tail = tail_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    // Claims up to `last - first` consecutive free cells with one CAS and
+    // publishes them with one wake; advances `first` past the values pushed.
+    template<typename Iterator>
+    RingPush try_push_batch(Iterator& first, Iterator last) {
+        if (first == last) return RingPush::Ok;
+        uint64_t tail = tail_.load(std::memory_order_relaxed);
+        while (true) {
+            if (tail & kClosedBit) return RingPush::Closed;
+            const uint64_t position = tail >> 1;
+            const auto remaining = static_cast<size_t>(std::distance(first, last));
+            const size_t wanted = remaining < capacity_ ? remaining : capacity_;
+            size_t claimable = 0;
+            uint64_t end = position;
+            while (claimable < wanted && sequence_of(end, std::memory_order_acquire) == 2 * end) {
+                ++claimable;
+                end = advance(end, 1);
+            }
+            if (claimable == 0) {
+                const uint64_t sequence = sequence_of(position, std::memory_order_acquire);
+                if (static_cast<int64_t>(sequence - 2 * position) < 0) return RingPush::Full;
+                tail = tail_.load(std::memory_order_relaxed);
+                continue;
+            }
+            if (!tail_.compare_exchange_weak(tail, end << 1, std::memory_order_relaxed)) continue;
+            for (uint64_t stamp = position; stamp != end; stamp = advance(stamp, 1), ++first) {
+                ::new (static_cast<void*>(cell_at(stamp).storage)) Value(*first);
+                publish(stamp, 2 * stamp + 1);
+            }
+            signal(items_epoch_, parked_consumers_, claimable);
+            return RingPush::Ok;
+        }
+    }
+
+    // Empty means nothing to take right now; Closed means empty for good.
+    RingPop try_pop(std::optional<Value>& out) {
+        uint64_t head = head_.load(std::memory_order_relaxed);
+        while (true) {
+            const uint64_t sequence = sequence_of(head, std::memory_order_acquire);
+            const auto difference = static_cast<int64_t>(sequence - (2 * head + 1));
+            if (difference == 0) {
+                if (head_.compare_exchange_weak(head, advance(head, 1), std::memory_order_relaxed)) {
+                    Value* value = cell_at(head).value();
+                    out.emplace(std::move(*value));
+                    value->~Value();
+                    publish(head, 2 * (head + one_lap_));
+                    signal(space_epoch_, parked_producers_);
+                    return RingPop::Ok;
+                }
+            } else if (difference < 0) {
+                const uint64_t tail = tail_.load(std::memory_order_acquire);
+                if ((tail >> 1) == head) return (tail & kClosedBit) ? RingPop::Closed : RingPop::Empty;
+                // A producer claimed this slot and is still writing it.
+                ring_cpu_relax();
+                head = head_.load(std::memory_order_relaxed);
+            } else {
+                head = head_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    // Takes up to `max_count` consecutive full cells with one CAS and appends
+    // them to `out` (anything with push_back(Value&&)).
+    template<typename Output>
+    RingPop try_pop_batch(Output& out, size_t max_count) {
+        uint64_t head = head_.load(std::memory_order_relaxed);
+        while (true) {
+            const size_t wanted = max_count < capacity_ ? max_count : capacity_;
+            size_t ready = 0;
+            uint64_t end = head;
+            while (ready < wanted && sequence_of(end, std::memory_order_acquire) == 2 * end + 1) {
+                ++ready;
+                end = advance(end, 1);
+            }
+            if (ready == 0) {
+                const uint64_t sequence = sequence_of(head, std::memory_order_acquire);
+                if (static_cast<int64_t>(sequence - (2 * head + 1)) > 0) {
+                    head = head_.load(std::memory_order_relaxed);
+                    continue;
+                }
+                const uint64_t tail = tail_.load(std::memory_order_acquire);
+                if ((tail >> 1) == head) return (tail & kClosedBit) ? RingPop::Closed : RingPop::Empty;
+                ring_cpu_relax();
+                head = head_.load(std::memory_order_relaxed);
+                continue;
+            }
+            if (!head_.compare_exchange_weak(head, end, std::memory_order_relaxed)) continue;
+            for (uint64_t stamp = head; stamp != end; stamp = advance(stamp, 1)) {
+                Value* value = cell_at(stamp).value();
+                out.push_back(std::move(*value));
+                value->~Value();
+                publish(stamp, 2 * (stamp + one_lap_));
+            }
+            signal(space_epoch_, parked_producers_, ready);
+            return RingPop::Ok;
+        }
+    }
+
+    // Blocks until pushed or closed; returns Full only once `should_stop()` holds.
+    template<typename Argument, typename ShouldStop>
+    RingPush push(Argument&& argument, ShouldStop&& should_stop) {
+        RingPush status = RingPush::Full;
+        park_until(space_epoch_, parked_producers_, [&] {
+            status = try_push(std::forward<Argument>(argument));
+            return status != RingPush::Full;
+        }, should_stop);
+        return status;
+    }
+
+    // Blocks until every value in [first, last) is pushed or the ring closes;
+    // returns how many were pushed.
+    template<typename Iterator>
+    size_t push_all(Iterator first, Iterator last) {
+        size_t pushed = 0;
+        while (first != last) {
+            const Iterator batch_start = first;
+            RingPush status = RingPush::Full;
+            park_until(space_epoch_, parked_producers_, [&] {
+                status = try_push_batch(first, last);
+                return status != RingPush::Full;
+            }, [] { return false; });
+            pushed += static_cast<size_t>(std::distance(batch_start, first));
+            if (status == RingPush::Closed) break;
+        }
+        return pushed;
+    }
+
+    // Blocks until at least one value is taken (then up to `max_count`) or the
+    // ring is closed and drained.
+    template<typename Output>
+    RingPop pop_batch(Output& out, size_t max_count) {
+        RingPop status = RingPop::Empty;
+        park_until(items_epoch_, parked_consumers_, [&] {
+            status = try_pop_batch(out, max_count);
+            return status != RingPop::Empty;
+        }, [] { return false; });
+        return status;
+    }
+
+    // Blocks until a value arrives, the ring is closed and drained, or
+    // `should_stop()` holds (then Empty).
+    template<typename ShouldStop>
+    RingPop pop(std::optional<Value>& out, ShouldStop&& should_stop) {
+        RingPop status = RingPop::Empty;
+        park_until(items_epoch_, parked_consumers_, [&] {
+            status = try_pop(out);
+            return status != RingPop::Empty;
+        }, should_stop);
+        return status;
+    }
+};
+
+} // namespace mlc::concurrency::detail
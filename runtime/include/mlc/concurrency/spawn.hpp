@@ -1,36 +1,73 @@
 #pragma once
 
-// Spawn a callable on a new thread; returns mlc::Task with copied result (TRACK_CONCURRENCY STEP=3).
+// Spawn a callable on the shared runtime executor (executor.hpp); returns
+// mlc::Task with copied result (TRACK_CONCURRENCY STEP=3).
 // Work starts eagerly so many spawn_task calls overlap before block_on.
 // Callable is decay-copied outside the coroutine frame (no dangling parameter).
+// An exception from the callable is rethrown by block_on / co_await.
+// Dropping the Task without awaiting it waits for the work, as the std::async
+// future this replaces did; work no worker has started yet runs inline then.
+// spawn_task(pool, f) targets a specific ThreadPool instead.
+// is_ready(task) turns true once the work has finished, so a loop can poll
+// several tasks and block_on only the ones that are done.
 
-#include <future>
+#include <atomic>
+#include <memory>
 #include <type_traits>
 #include <utility>
+#include "mlc/concurrency/executor.hpp"
+#include "mlc/concurrency/thread_pool.hpp"
 #include "mlc/core/task.hpp"
 
 namespace mlc::concurrency {
 
 namespace detail {
 
+// Owned by the task coroutine frame: joins the job when the frame goes away.
 template<typename Result>
-mlc::Task<Result> task_from_future(std::future<Result> future) {
-    co_return future.get();
+class SpawnedWork {
+    std::shared_ptr<ForkedJob<Result>> job_;
+
+public:
+    explicit SpawnedWork(std::shared_ptr<ForkedJob<Result>> job) : job_(std::move(job)) {}
+    SpawnedWork(SpawnedWork&&) noexcept = default;
+    SpawnedWork& operator=(SpawnedWork&&) = delete;
+    ~SpawnedWork() {
+        if (job_) job_->wait();
+    }
+
+    Result get() {
+        auto job = std::move(job_);
+        return job->get();
+    }
+};
+
+template<typename Result>
+mlc::Task<Result> task_from_job(SpawnedWork<Result> work) {
+    co_return work.get();
 }
 
-inline mlc::Task<void> task_from_future(std::future<void> future) {
-    future.get();
+inline mlc::Task<void> task_from_job(SpawnedWork<void> work) {
+    work.get();
     co_return;
 }
 
 } // namespace detail
 
+template<typename Callable>
+auto spawn_task(ThreadPool& pool, Callable&& callable)
+    -> mlc::Task<std::invoke_result_t<std::decay_t<Callable>>> {
+    using Result = std::invoke_result_t<std::decay_t<Callable>>;
+    auto job = detail::fork_job(pool, std::forward<Callable>(callable));
+    const std::atomic<bool>* finished = &job->finished();
+    auto task = detail::task_from_job(detail::SpawnedWork<Result>(std::move(job)));
+    task.track_completion(finished);
+    return task;
+}
+
 template<typename Callable>
 auto spawn_task(Callable&& callable) -> mlc::Task<std::invoke_result_t<std::decay_t<Callable>>> {
-    using Decayed = std::decay_t<Callable>;
-    using Result = std::invoke_result_t<Decayed>;
-    auto future = std::async(std::launch::async, Decayed(std::forward<Callable>(callable)));
-    return detail::task_from_future(std::move(future));
+    return spawn_task(runtime_executor(), std::forward<Callable>(callable));
 }
 
 } // namespace mlc::concurrency
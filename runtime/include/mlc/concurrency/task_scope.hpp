@@ -3,10 +3,18 @@
 // Structured concurrency scope (TRACK_CONCURRENCY_TASKSCOPE STEP=2).
 // Invariant: destructor / join() waits for all spawned children.
 // Children may observe StopToken from scope.token(); request_cancel() wakes them.
+// Children run on the shared runtime executor (executor.hpp), or on the
+// ThreadPool passed to TaskScope(pool). join() runs inline any child no worker
+// has picked up yet, so nested scopes do not tie up workers waiting for queued
+// children. A child the pool refuses (shut down / cancelled) runs at join().
+// join() waits for every child, then rethrows the first child exception.
 
+#include "mlc/concurrency/executor.hpp"
 #include "mlc/concurrency/stop.hpp"
+#include "mlc/concurrency/thread_pool.hpp"
 
-#include <future>
+#include <exception>
+#include <memory>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -15,24 +23,41 @@ namespace mlc::concurrency {
 
 class TaskScope {
     StopSource stop_;
-    std::vector<std::future<void>> children_;
+    ThreadPool* pool_ = nullptr; // nullptr: runtime_executor(), resolved on first spawn
+    std::vector<std::shared_ptr<detail::ForkedJob<void>>> children_;
     bool joined_ = false;
 
+    template<typename Body>
+    void launch(Body&& body) {
+        joined_ = false;
+        ThreadPool& pool = pool_ != nullptr ? *pool_ : runtime_executor();
+        children_.push_back(detail::fork_job(pool, std::forward<Body>(body)));
+    }
+
     void join_unlocked() {
-        for (auto& child : children_) {
-            if (child.valid()) child.get();
-        }
+        std::vector<std::shared_ptr<detail::ForkedJob<void>>> children = std::move(children_);
         children_.clear();
+        std::exception_ptr first_error;
+        for (auto& child : children) {
+            try {
+                child->get();
+            } catch (...) {
+                if (!first_error) first_error = std::current_exception();
+            }
+        }
         joined_ = true;
+        if (first_error) std::rethrow_exception(first_error);
     }
 
 public:
     TaskScope() = default;
+    explicit TaskScope(ThreadPool& pool) : pool_(&pool) {}
     TaskScope(const TaskScope&) = delete;
     TaskScope& operator=(const TaskScope&) = delete;
 
     TaskScope(TaskScope&& other) noexcept
         : stop_(std::move(other.stop_))
+        , pool_(other.pool_)
         , children_(std::move(other.children_))
         , joined_(other.joined_) {
         other.joined_ = true;
@@ -44,6 +69,7 @@ public:
         request_cancel();
         join();
         stop_ = std::move(other.stop_);
+        pool_ = other.pool_;
         children_ = std::move(other.children_);
         joined_ = other.joined_;
         other.joined_ = true;
@@ -66,26 +92,20 @@ public:
     template<typename Callable>
     void spawn(Callable&& callable) {
         using Decayed = std::decay_t<Callable>;
-        joined_ = false;
-        children_.push_back(std::async(
-            std::launch::async,
-            [callable = Decayed(std::forward<Callable>(callable))]() mutable {
-                callable();
-            }));
+        launch([callable = Decayed(std::forward<Callable>(callable))]() mutable {
+            callable();
+        });
     }
 
     // Spawn work that receives this scope's StopToken.
     template<typename Callable>
     void spawn_with_token(Callable&& callable) {
         using Decayed = std::decay_t<Callable>;
-        joined_ = false;
         StopToken child_token = token();
-        children_.push_back(std::async(
-            std::launch::async,
-            [callable = Decayed(std::forward<Callable>(callable)),
-             child_token]() mutable {
-                callable(child_token);
-            }));
+        launch([callable = Decayed(std::forward<Callable>(callable)),
+                child_token]() mutable {
+            callable(child_token);
+        });
     }
 
     void join() {
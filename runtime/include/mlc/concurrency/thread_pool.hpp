@@ -4,12 +4,33 @@
 // submit blocks when the queue is full (no silent drop).
 // shutdown/dtor: request_cancel → close queue → join workers.
 // Blocked submit wakes on cancel (ChannelStatus::Cancelled).
+//
+// PoolScheduling::WorkStealing: each worker owns a Chase-Lev deque
+// (work_stealing_deque.hpp). submit from a worker of this pool pushes onto
+// that worker's deque (never blocks; popped LIFO by the owner, stolen FIFO by
+// idle workers); submit from any other thread goes through the bounded queue
+// above, which becomes the injection queue with the same blocking/cancel
+// contract. Idle workers spin briefly, then park on an epoch counter.
+// help_one() runs one pending job on the calling thread.
+//
+// max_worker_count > worker_count (WorkStealing only): a monitor thread adds a
+// worker when work is queued, no worker is idle and none finished a job during
+// the last tick, i.e. every worker is blocked. Jobs that block on channels or
+// futures then cannot starve the rest of the queue. Used by runtime_executor().
 
 #include "mlc/concurrency/channel.hpp"
+#include "mlc/concurrency/mpmc_ring.hpp"
 #include "mlc/concurrency/stop.hpp"
+#include "mlc/concurrency/work_stealing_deque.hpp"
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <cstddef>
+#include <cstdint>
 #include <functional>
+#include <memory>
+#include <mutex>
 #include <stdexcept>
 #include <thread>
 #include <type_traits>
@@ -18,10 +39,53 @@
 
 namespace mlc::concurrency {
 
+// Worker count for CPU-bound fan-out: hardware threads, at least 1.
+inline int32_t default_worker_count() noexcept {
+    const unsigned hardware = std::thread::hardware_concurrency();
+    return hardware == 0 ? 1 : static_cast<int32_t>(hardware);
+}
+
+enum class PoolScheduling { SharedQueue, WorkStealing };
+
 class ThreadPool {
+    using Job = std::function<void()>;
+
+    static constexpr int kIdleSpinLimit = 64;
+    static constexpr auto kStarvationTick = std::chrono::milliseconds(10);
+    static constexpr auto kIdleMonitorTick = std::chrono::milliseconds(100);
+
+    struct WorkerSlot {
+        detail::WorkStealingDeque<Job> deque;
+        // Written only by the owning worker; read by the growth monitor.
+        std::atomic<bool> idle{false};
+        std::atomic<uint64_t> completed{0};
+    };
+
+    // Set on pool worker threads so submit/help_one can find the local deque.
+    struct CurrentWorker {
+        const ThreadPool* pool = nullptr;
+        std::size_t index = 0;
+    };
+
+    static CurrentWorker& current_worker() noexcept {
+        thread_local CurrentWorker current;
+        return current;
+    }
+
     StopSource stop_;
-    Channel<std::function<void()>> jobs_;
+    Channel<Job> jobs_;
+    const PoolScheduling scheduling_;
+    const std::size_t max_worker_count_;
+    // WorkStealing: max_worker_count_ slots; the first started_workers_ are live.
+    std::unique_ptr<std::unique_ptr<WorkerSlot>[]> slots_;
+    std::atomic<std::size_t> started_workers_{0};
     std::vector<std::thread> workers_;
+    std::thread monitor_;
+    std::mutex monitor_mutex_;
+    std::condition_variable monitor_wake_;
+    alignas(64) std::atomic<uint32_t> idle_epoch_{0};
+    std::atomic<uint32_t> sleeping_workers_{0};
+    std::atomic<bool> closing_{false};
     bool shut_down_ = false;
 
     void worker_loop() {
@@ -32,40 +96,203 @@ class ThreadPool {
         }
     }
 
+    WorkerSlot* local_slot() const noexcept {
+        const CurrentWorker& current = current_worker();
+        return current.pool == this ? slots_[current.index].get() : nullptr;
+    }
+
+    // Own deque first, then the injection queue, then the other deques
+    // starting after `start` so thieves spread over victims.
+    std::unique_ptr<Job> find_job(std::size_t start) {
+        if (WorkerSlot* local = local_slot()) {
+            if (Job* job = local->deque.pop()) return std::unique_ptr<Job>(job);
+        }
+        if (auto injected = jobs_.try_receive()) {
+            return std::make_unique<Job>(std::move(*injected));
+        }
+        const std::size_t count = started_workers_.load(std::memory_order_acquire);
+        for (std::size_t offset = 1; offset <= count; ++offset) {
+            if (Job* job = slots_[(start + offset) % count]->deque.steal()) return std::unique_ptr<Job>(job);
+        }
+        return nullptr;
+    }
+
+    bool has_visible_work() const {
+        const std::size_t count = started_workers_.load(std::memory_order_acquire);
+        for (std::size_t index = 0; index < count; ++index) {
+            if (!slots_[index]->deque.empty()) return true;
+        }
+        return jobs_.size() > 0;
+    }
+
+    // Pairs with park(): the waker publishes work, then reads sleeping_workers_
+    // (seq_cst); the sleeper registers, then re-checks. One of them sees the other.
+    void wake_one() noexcept {
+        if (sleeping_workers_.load(std::memory_order_seq_cst) == 0) return;
+        idle_epoch_.fetch_add(1, std::memory_order_seq_cst);
+        idle_epoch_.notify_one();
+    }
+
+    void wake_all() noexcept {
+        idle_epoch_.fetch_add(1, std::memory_order_seq_cst);
+        idle_epoch_.notify_all();
+    }
+
+    // Returns false when the pool is closing and no work is left anywhere.
+    bool park(WorkerSlot& slot) {
+        slot.idle.store(true, std::memory_order_relaxed);
+        for (int spin = 0; spin < kIdleSpinLimit; ++spin) {
+            if (has_visible_work()) {
+                slot.idle.store(false, std::memory_order_relaxed);
+                return true;
+            }
+            if (spin < kIdleSpinLimit / 2) detail::ring_cpu_relax();
+            else std::this_thread::yield();
+        }
+        const uint32_t observed = idle_epoch_.load(std::memory_order_seq_cst);
+        sleeping_workers_.fetch_add(1, std::memory_order_seq_cst);
+        bool keep_running = true;
+        if (!has_visible_work()) {
+            if (closing_.load(std::memory_order_seq_cst)) keep_running = false;
+            else idle_epoch_.wait(observed, std::memory_order_seq_cst);
+        }
+        sleeping_workers_.fetch_sub(1, std::memory_order_seq_cst);
+        slot.idle.store(false, std::memory_order_relaxed);
+        return keep_running;
+    }
+
+    void stealing_worker_loop(std::size_t index) {
+        current_worker() = CurrentWorker{this, index};
+        WorkerSlot& slot = *slots_[index];
+        while (true) {
+            if (auto job = find_job(index)) {
+                (*job)();
+                slot.completed.store(slot.completed.load(std::memory_order_relaxed) + 1,
+                                     std::memory_order_relaxed);
+                continue;
+            }
+            if (!park(slot)) break;
+        }
+        current_worker() = CurrentWorker{};
+    }
+
+    // Constructor or monitor thread only.
+    void start_stealing_worker() {
+        const std::size_t index = started_workers_.load(std::memory_order_relaxed);
+        slots_[index] = std::make_unique<WorkerSlot>();
+        started_workers_.store(index + 1, std::memory_order_release);
+        workers_.emplace_back([this, index] { stealing_worker_loop(index); });
+    }
+
+    void monitor_loop() {
+        uint64_t last_completed = 0;
+        std::unique_lock<std::mutex> lock(monitor_mutex_);
+        auto tick = kStarvationTick;
+        while (!closing_.load(std::memory_order_seq_cst)) {
+            monitor_wake_.wait_for(lock, tick);
+            if (closing_.load(std::memory_order_seq_cst)) break;
+            const std::size_t count = started_workers_.load(std::memory_order_relaxed);
+            uint64_t completed = 0;
+            bool any_idle = false;
+            for (std::size_t index = 0; index < count; ++index) {
+                completed += slots_[index]->completed.load(std::memory_order_relaxed);
+                any_idle = any_idle || slots_[index]->idle.load(std::memory_order_relaxed);
+            }
+            if (!any_idle && completed == last_completed && count < max_worker_count_ && has_visible_work()) {
+                start_stealing_worker();
+            }
+            last_completed = completed;
+            tick = any_idle ? kIdleMonitorTick : kStarvationTick;
+        }
+    }
+
     void join_workers() {
+        if (monitor_.joinable()) monitor_.join();
         for (auto& worker : workers_) {
             if (worker.joinable()) worker.join();
         }
         workers_.clear();
     }
 
-    bool enqueue(std::function<void()> job) {
+    bool enqueue(Job job) {
+        if (scheduling_ == PoolScheduling::WorkStealing) {
+            if (WorkerSlot* local = local_slot()) {
+                // Workers never take the shut_down_ path; the stop flag is what
+                // shutdown() sets first.
+                if (stop_.requested()) return false;
+                local->deque.push(new Job(std::move(job)));
+                wake_one();
+                return true;
+            }
+        }
         if (shut_down_) return false;
         const ChannelStatus status = jobs_.send(std::move(job), stop_.token());
-        return status == ChannelStatus::Ok;
+        if (status != ChannelStatus::Ok) return false;
+        if (scheduling_ == PoolScheduling::WorkStealing) {
+            idle_epoch_.fetch_add(1, std::memory_order_seq_cst);
+            if (sleeping_workers_.load(std::memory_order_seq_cst) > 0) idle_epoch_.notify_one();
+        }
+        return true;
     }
 
-public:
-    ThreadPool(std::size_t worker_count, std::size_t queue_capacity)
-        : jobs_(queue_capacity == 0 ? 1 : queue_capacity) {
+    ThreadPool(Channel<Job> jobs, std::size_t worker_count, PoolScheduling scheduling,
+               std::size_t max_worker_count)
+        : jobs_(std::move(jobs))
+        , scheduling_(scheduling)
+        , max_worker_count_(max_worker_count < worker_count ? worker_count : max_worker_count) {
         if (worker_count == 0) {
             throw std::invalid_argument("ThreadPool worker_count must be >= 1");
         }
-        if (queue_capacity == 0) {
-            throw std::invalid_argument("ThreadPool queue_capacity must be >= 1");
+        if (max_worker_count_ > worker_count && scheduling_ != PoolScheduling::WorkStealing) {
+            throw std::invalid_argument("ThreadPool max_worker_count needs PoolScheduling::WorkStealing");
+        }
+        workers_.reserve(max_worker_count_);
+        if (scheduling_ == PoolScheduling::WorkStealing) {
+            slots_ = std::make_unique<std::unique_ptr<WorkerSlot>[]>(max_worker_count_);
+            for (std::size_t index = 0; index < worker_count; ++index) start_stealing_worker();
+            if (max_worker_count_ > worker_count) monitor_ = std::thread([this] { monitor_loop(); });
+            return;
         }
-        workers_.reserve(worker_count);
         for (std::size_t index = 0; index < worker_count; ++index) {
             workers_.emplace_back([this] { worker_loop(); });
         }
+        started_workers_.store(worker_count, std::memory_order_relaxed);
     }
 
+    static std::size_t validate_queue_capacity(std::size_t queue_capacity) {
+        if (queue_capacity == 0) {
+            throw std::invalid_argument("ThreadPool queue_capacity must be >= 1");
+        }
+        return queue_capacity;
+    }
+
+public:
+    ThreadPool(std::size_t worker_count, std::size_t queue_capacity,
+               PoolScheduling scheduling = PoolScheduling::SharedQueue,
+               std::size_t max_worker_count = 0)
+        : ThreadPool(Channel<Job>(validate_queue_capacity(queue_capacity)), worker_count, scheduling,
+                     max_worker_count) {}
+
+    // Unbounded job queue: submit never blocks (only fails after shutdown/cancel).
+    ThreadPool(std::size_t worker_count, UnboundedChannelTag,
+               PoolScheduling scheduling = PoolScheduling::SharedQueue,
+               std::size_t max_worker_count = 0)
+        : ThreadPool(Channel<Job>(UnboundedChannelTag{}), worker_count, scheduling, max_worker_count) {}
+
     ThreadPool(const ThreadPool&) = delete;
     ThreadPool& operator=(const ThreadPool&) = delete;
     ThreadPool(ThreadPool&&) = delete;
     ThreadPool& operator=(ThreadPool&&) = delete;
 
-    ~ThreadPool() { shutdown(); }
+    ~ThreadPool() {
+        shutdown();
+        const std::size_t count = scheduling_ == PoolScheduling::WorkStealing
+                                      ? started_workers_.load(std::memory_order_relaxed)
+                                      : 0;
+        for (std::size_t index = 0; index < count; ++index) {
+            while (Job* job = slots_[index]->deque.steal()) delete job;
+        }
+    }
 
     [[nodiscard]] StopToken token() const noexcept { return stop_.token(); }
 
@@ -74,9 +301,10 @@ public:
     [[nodiscard]] bool cancel_requested() const noexcept { return stop_.requested(); }
 
     // Enqueue work. Blocks if the queue is full. Returns false after shutdown/cancel.
+    // In WorkStealing mode, a call from one of this pool's workers never blocks.
     template<typename Callable>
     bool submit(Callable&& callable) {
-        return enqueue(std::function<void()>(std::forward<Callable>(callable)));
+        return enqueue(Job(std::forward<Callable>(callable)));
     }
 
     // Enqueue work that receives this pool's StopToken.
@@ -84,21 +312,53 @@ public:
     bool submit_with_token(Callable&& callable) {
         using Decayed = std::decay_t<Callable>;
         StopToken child_token = token();
-        return enqueue(std::function<void()>(
+        return enqueue(Job(
             [callable = Decayed(std::forward<Callable>(callable)),
              child_token]() mutable { callable(child_token); }));
     }
 
+    // Run one pending job on the calling thread, if any is available (own deque,
+    // injection queue, then stealing). Returns false if nothing was run.
+    // Always false in SharedQueue mode, where only workers dequeue.
+    bool help_one() {
+        if (scheduling_ != PoolScheduling::WorkStealing) return false;
+        const CurrentWorker& current = current_worker();
+        const std::size_t start = current.pool == this ? current.index : 0;
+        auto job = find_job(start);
+        if (!job) return false;
+        (*job)();
+        return true;
+    }
+
+    // True on a worker thread of this pool.
+    [[nodiscard]] bool on_worker_thread() const noexcept { return current_worker().pool == this; }
+
     // request_cancel, close the job queue, join all workers. Idempotent.
+    // Jobs already queued (and, in WorkStealing mode, already in a deque) still run.
     void shutdown() {
         if (shut_down_) return;
         shut_down_ = true;
         request_cancel();
         jobs_.close();
+        if (scheduling_ == PoolScheduling::WorkStealing) {
+            {
+                std::lock_guard<std::mutex> lock(monitor_mutex_);
+                closing_.store(true, std::memory_order_seq_cst);
+            }
+            monitor_wake_.notify_all();
+            wake_all();
+        }
         join_workers();
     }
 
-    [[nodiscard]] std::size_t worker_count() const noexcept { return workers_.size(); }
+    // Workers started so far (grows up to max_worker_count); 0 after shutdown.
+    [[nodiscard]] std::size_t worker_count() const noexcept {
+        return shut_down_ ? 0 : started_workers_.load(std::memory_order_acquire);
+    }
+
+    [[nodiscard]] std::size_t max_worker_count() const noexcept { return max_worker_count_; }
+
+    [[nodiscard]] PoolScheduling scheduling() const noexcept { return scheduling_; }
 
     [[nodiscard]] bool is_shutdown() const noexcept { return shut_down_; }
 };
@@ -0,0 +1,124 @@
+#pragma once
+
+// Chase-Lev work-stealing deque of pointers (ThreadPool work-stealing mode).
+// The owning worker pushes and pops at the bottom (LIFO, no CAS unless the
+// deque is down to one item); any other thread steals from the top (FIFO, one
+// CAS). The buffer grows by doubling; retired buffers stay alive until the
+// deque is destroyed because a thief may still be reading a slot from one.
+//
+// Ordering follows Lê et al. (PPoPP 2013) with the two seq_cst fences folded
+// into seq_cst operations on top_/bottom_, so the protocol is visible to TSAN.
+// push() stores bottom_ seq_cst as well: ThreadPool's sleep protocol relies on
+// a parked worker's re-check (empty()) seeing any push that its waker missed.
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace mlc::concurrency::detail {
+
+template<typename Item>
+class WorkStealingDeque {
+    static constexpr size_t kCacheLine = 64;
+
+    struct Buffer {
+        const int64_t capacity;
+        std::unique_ptr<std::atomic<Item*>[]> slots;
+
+        explicit Buffer(int64_t size)
+            : capacity(size), slots(std::make_unique<std::atomic<Item*>[]>(static_cast<size_t>(size))) {}
+
+        Item* get(int64_t index) const noexcept {
+            return slots[static_cast<size_t>(index & (capacity - 1))].load(std::memory_order_relaxed);
+        }
+
+        void put(int64_t index, Item* item) noexcept {
+            slots[static_cast<size_t>(index & (capacity - 1))].store(item, std::memory_order_relaxed);
+        }
+    };
+
+    alignas(kCacheLine) std::atomic<int64_t> top_{0};
+    alignas(kCacheLine) std::atomic<int64_t> bottom_{0};
+    std::atomic<Buffer*> buffer_;
+    std::vector<std::unique_ptr<Buffer>> buffers_; // owner-only
+
+    Buffer* grow(Buffer* old, int64_t top, int64_t bottom) {
+        auto larger = std::make_unique<Buffer>(old->capacity * 2);
+        for (int64_t index = top; index < bottom; ++index) larger->put(index, old->get(index));
+        Buffer* raw = larger.get();
+        buffers_.push_back(std::move(larger));
+        buffer_.store(raw, std::memory_order_release);
+        return raw;
+    }
+
+public:
+    explicit WorkStealingDeque(size_t initial_capacity = 256) {
+        int64_t capacity = 1;
+        while (capacity < static_cast<int64_t>(initial_capacity)) capacity *= 2;
+        buffers_.push_back(std::make_unique<Buffer>(capacity));
+        buffer_.store(buffers_.back().get(), std::memory_order_relaxed);
+    }
+
+    WorkStealingDeque(const WorkStealingDeque&) = delete;
+    WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+    // Owner only.
+    void push(Item* item) {
+        const int64_t bottom = bottom_.load(std::memory_order_relaxed);
+        const int64_t top = top_.load(std::memory_order_acquire);
+        Buffer* buffer = buffer_.load(std::memory_order_relaxed);
+        if (bottom - top >= buffer->capacity) buffer = grow(buffer, top, bottom);
+        buffer->put(bottom, item);
+        bottom_.store(bottom + 1, std::memory_order_seq_cst);
+    }
+
+    // Owner only. Returns nullptr when empty or when a thief took the last item.
+    Item* pop() noexcept {
+        const int64_t bottom = bottom_.load(std::memory_order_relaxed) - 1;
+        Buffer* buffer = buffer_.load(std::memory_order_relaxed);
+        bottom_.store(bottom, std::memory_order_seq_cst);
+        int64_t top = top_.load(std::memory_order_seq_cst);
+        if (top > bottom) {
+            bottom_.store(bottom + 1, std::memory_order_relaxed);
+            return nullptr;
+        }
+        Item* item = buffer->get(bottom);
+        if (top == bottom) {
+            if (!top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst,
+                                              std::memory_order_relaxed)) {
+                item = nullptr;
+            }
+            bottom_.store(bottom + 1, std::memory_order_relaxed);
+        }
+        return item;
+    }
+
+    // Any thread. Returns nullptr when empty or when another thread won the race.
+    Item* steal() noexcept {
+        int64_t top = top_.load(std::memory_order_seq_cst);
+        const int64_t bottom = bottom_.load(std::memory_order_seq_cst);
+        if (top >= bottom) return nullptr;
+        Item* item = buffer_.load(std::memory_order_acquire)->get(top);
+        if (!top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst,
+                                          std::memory_order_relaxed)) {
+            return nullptr;
+        }
+        return item;
+    }
+
+    bool empty() const noexcept {
+        const int64_t bottom = bottom_.load(std::memory_order_seq_cst);
+        const int64_t top = top_.load(std::memory_order_seq_cst);
+        return bottom <= top;
+    }
+
+    size_t size() const noexcept {
+        const int64_t bottom = bottom_.load(std::memory_order_seq_cst);
+        const int64_t top = top_.load(std::memory_order_seq_cst);
+        return bottom > top ? static_cast<size_t>(bottom - top) : 0;
+    }
+};
+
+} // namespace mlc::concurrency::detail
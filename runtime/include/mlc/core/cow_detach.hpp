@@ -1,24 +1,49 @@
 #ifndef MLC_CORE_COW_DETACH_HPP
 #define MLC_CORE_COW_DETACH_HPP
 
+#include <atomic>
 #include <memory>
 
-// Copy-on-write detach for mlc::Array / mlc::HashMap internal buffers.
+// Copy-on-write detach for mlc::Array / mlc::HashMap internal buffers (and the
+// trie nodes of PersistentMap).
 //
-// Thread safety (TRACK_CONCURRENCY STEP=1):
-// - std::shared_ptr refcount updates are atomic.
-// - detach() is NOT atomic: use_count() check + deep copy can race if two threads
-//   mutate the same logical collection through distinct Array/HashMap copies.
-// - MLC is single-threaded today; concurrent mutation of shared COW buffers is UB.
-// - String heap buffers are not mutated in place through shared_ptr (+= builds new).
-// - Until Channel/Arc/Mutex land, do not share Array/HashMap across threads.
+// Thread safety:
+// - A buffer with more than one owner is never written: every mutation goes
+//   through detach_shared_buffer(), which copies it first. Shared buffers are
+//   therefore read-only, and any number of threads may read them.
+// - A buffer with a single owner is written in place. Seeing use_count() == 1
+//   means every other owner has released it; the acquire fence pairs with the
+//   release half of their refcount decrement, so their earlier reads
+//   happen-before our writes. On x86 the fence compiles to nothing, so the
+//   single-threaded cost is unchanged.
+// - Distinct Array/HashMap copies may therefore be handed to other threads
+//   (spawn, Channel, ThreadPool) and read or mutated there without a deep copy.
+//   One Array/HashMap object mutated from two threads at once is still a data
+//   race, as for std::vector; wrap it in Mutex instead.
+// - String buffers use the same rule with their own atomic refcount (string.hpp).
+
+#if defined(__SANITIZE_THREAD__)
+#define MLC_COW_THREAD_SANITIZER 1
+#elif defined(__has_feature)
+#if __has_feature(thread_sanitizer)
+#define MLC_COW_THREAD_SANITIZER 1
+#endif
+#endif
 
 namespace mlc::cow {
 
 template<typename Buffer>
 inline void detach_shared_buffer(std::shared_ptr<Buffer>& buffer) {
-    if (buffer.use_count() > 1)
+    if (buffer.use_count() > 1) {
         buffer = std::make_shared<Buffer>(*buffer);
+        return;
+    }
+#if defined(MLC_COW_THREAD_SANITIZER)
+    // TSAN does not model fences; lock() is an acquire RMW on the same counter.
+    (void)std::weak_ptr<Buffer>(buffer).lock();
+#else
+    std::atomic_thread_fence(std::memory_order_acquire);
+#endif
 }
 
 } // namespace mlc::cow
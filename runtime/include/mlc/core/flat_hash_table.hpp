@@ -0,0 +1,221 @@
+#ifndef MLC_CORE_FLAT_HASH_TABLE_HPP
+#define MLC_CORE_FLAT_HASH_TABLE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <utility>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define MLC_FLAT_HASH_SSE2 1
+#endif
+
+namespace mlc::detail {
+
+// Open-addressing hash table behind mlc::HashMap (SwissTable-style probing).
+//
+// Entries live densely in insertion order (`entries_`, with their full hashes
+// in `hashes_`); `ctrl_`/`slot_entry_` form the index. Each index slot has one
+// control byte: kEmpty, kDeleted, or the low 7 bits of the entry's hash. A
+// probe loads 16 control bytes at once and compares them all against those 7
+// bits (one SSE2 compare where available), so a lookup usually touches one
+// group of control bytes and one entry. The first kGroupWidth control bytes are
+// mirrored past the end so a group load never wraps. The index stays at most
+// 7/8 full (tombstones included) and always has a power-of-two capacity ≥ 16.
+//
+// remove() moves the last entry into the hole, so iteration order is
+// insertion order until the first removal and deterministic after it.
+// Copying deep-copies entries and index (used by COW detach).
+template<typename K, typename V, typename Hash = std::hash<K>>
+class FlatHashTable {
+public:
+    using Entry = std::pair<K, V>;
+
+private:
+    static constexpr size_t kGroupWidth = 16;
+    static constexpr size_t kMinCapacity = 16;
+    static constexpr int8_t kEmpty = -128;
+    static constexpr int8_t kDeleted = -2;
+    static constexpr size_t kNotFound = static_cast<size_t>(-1);
+
+    std::vector<Entry>    entries_;
+    std::vector<uint64_t> hashes_;
+    std::vector<int8_t>   ctrl_;        // capacity + kGroupWidth bytes
+    std::vector<uint32_t> slot_entry_;  // entry index per full slot
+    size_t capacity_ = 0;
+    size_t tombstones_ = 0;
+
+    static uint64_t mix(size_t raw) noexcept {
+        uint64_t h = static_cast<uint64_t>(raw) * 0x9E3779B97F4A7C15ull;
+        return h ^ (h >> 29);
+    }
+
+    static int8_t h2_of(uint64_t hash) noexcept { return static_cast<int8_t>(hash & 0x7f); }
+    static size_t h1_of(uint64_t hash) noexcept { return static_cast<size_t>(hash >> 7); }
+
+    // Bit i set ⇔ control byte pos+i equals `value`.
+    uint32_t match_byte(size_t pos, int8_t value) const noexcept {
+#ifdef MLC_FLAT_HASH_SSE2
+        __m128i group = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ctrl_.data() + pos));
+        return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(group, _mm_set1_epi8(value))));
+#else
+        uint32_t mask = 0;
+        for (size_t i = 0; i < kGroupWidth; ++i)
+            if (ctrl_[pos + i] == value) mask |= 1u << i;
+        return mask;
+#endif
+    }
+
+    // Bit i set ⇔ control byte pos+i is empty or deleted (sign bit).
+    uint32_t match_free(size_t pos) const noexcept {
+#ifdef MLC_FLAT_HASH_SSE2
+        __m128i group = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ctrl_.data() + pos));
+        return static_cast<uint32_t>(_mm_movemask_epi8(group));
+#else
+        uint32_t mask = 0;
+        for (size_t i = 0; i < kGroupWidth; ++i)
+            if (ctrl_[pos + i] < 0) mask |= 1u << i;
+        return mask;
+#endif
+    }
+
+    static unsigned lowest_bit(uint32_t mask) noexcept { return static_cast<unsigned>(__builtin_ctz(mask)); }
+
+    void set_ctrl(size_t slot, int8_t value) noexcept {
+        ctrl_[slot] = value;
+        if (slot < kGroupWidth) ctrl_[capacity_ + slot] = value;
+    }
+
+    // Index slot holding `key`, or kNotFound.
+    size_t find_slot(const K& key, uint64_t hash) const {
+        if (capacity_ == 0) return kNotFound;
+        const size_t mask = capacity_ - 1;
+        const int8_t h2 = h2_of(hash);
+        size_t pos = h1_of(hash) & mask;
+        for (size_t step = kGroupWidth;; step += kGroupWidth) {
+            for (uint32_t candidates = match_byte(pos, h2); candidates != 0; candidates &= candidates - 1) {
+                size_t slot = (pos + lowest_bit(candidates)) & mask;
+                uint32_t entry = slot_entry_[slot];
+                if (hashes_[entry] == hash && entries_[entry].first == key) return slot;
+            }
+            if (match_byte(pos, kEmpty) != 0) return kNotFound;
+            pos = (pos + step) & mask;
+        }
+    }
+
+    // First empty or deleted slot on `hash`'s probe sequence.
+    size_t find_free_slot(uint64_t hash) const noexcept {
+        const size_t mask = capacity_ - 1;
+        size_t pos = h1_of(hash) & mask;
+        for (size_t step = kGroupWidth;; step += kGroupWidth) {
+            uint32_t free_slots = match_free(pos);
+            if (free_slots != 0) return (pos + lowest_bit(free_slots)) & mask;
+            pos = (pos + step) & mask;
+        }
+    }
+
+    // Slot whose entry index is `entry` (the entry must be indexed).
+    size_t slot_of_entry(uint32_t entry) const noexcept {
+        const size_t mask = capacity_ - 1;
+        const uint64_t hash = hashes_[entry];
+        const int8_t h2 = h2_of(hash);
+        size_t pos = h1_of(hash) & mask;
+        for (size_t step = kGroupWidth;; step += kGroupWidth) {
+            for (uint32_t candidates = match_byte(pos, h2); candidates != 0; candidates &= candidates - 1) {
+                size_t slot = (pos + lowest_bit(candidates)) & mask;
+                if (slot_entry_[slot] == entry) return slot;
+            }
+            pos = (pos + step) & mask;
+        }
+    }
+
+    void rebuild_index(size_t capacity) {
+        capacity_ = capacity;
+        tombstones_ = 0;
+        ctrl_.assign(capacity + kGroupWidth, kEmpty);
+        slot_entry_.assign(capacity, 0);
+        for (size_t entry = 0; entry < entries_.size(); ++entry) {
+            size_t slot = find_free_slot(hashes_[entry]);
+            set_ctrl(slot, h2_of(hashes_[entry]));
+            slot_entry_[slot] = static_cast<uint32_t>(entry);
+        }
+    }
+
+    static bool fits(size_t used, size_t capacity) noexcept { return used * 8 <= capacity * 7; }
+
+    // Room for one more entry. Doubles when live entries fill more than 7/16
+    // of the index; otherwise rebuilds at the same size to drop tombstones.
+    void reserve_one() {
+        const size_t needed = entries_.size() + 1;
+        if (capacity_ != 0 && fits(needed + tombstones_, capacity_)) return;
+        size_t capacity = capacity_ == 0 ? kMinCapacity : capacity_;
+        if (!fits(needed * 2, capacity)) capacity *= 2;
+        while (!fits(needed, capacity)) capacity *= 2;
+        rebuild_index(capacity);
+    }
+
+    size_t insert_new(K key, V value, uint64_t hash) {
+        reserve_one();
+        size_t slot = find_free_slot(hash);
+        if (ctrl_[slot] == kDeleted) --tombstones_;
+        set_ctrl(slot, h2_of(hash));
+        slot_entry_[slot] = static_cast<uint32_t>(entries_.size());
+        entries_.emplace_back(std::move(key), std::move(value));
+        hashes_.push_back(hash);
+        return entries_.size() - 1;
+    }
+
+public:
+    size_t size()  const noexcept { return entries_.size(); }
+    bool   empty() const noexcept { return entries_.empty(); }
+
+    static uint64_t hash_key(const K& key) { return mix(Hash{}(key)); }
+
+    // Entry for `key`, or nullptr.
+    const Entry* find(const K& key) const {
+        size_t slot = find_slot(key, hash_key(key));
+        return slot == kNotFound ? nullptr : &entries_[slot_entry_[slot]];
+    }
+
+    void insert_or_assign(const K& key, const V& value) {
+        const uint64_t hash = hash_key(key);
+        size_t slot = find_slot(key, hash);
+        if (slot != kNotFound) {
+            entries_[slot_entry_[slot]].second = value;
+            return;
+        }
+        insert_new(key, value, hash);
+    }
+
+    V& operator[](const K& key) {
+        const uint64_t hash = hash_key(key);
+        size_t slot = find_slot(key, hash);
+        if (slot != kNotFound) return entries_[slot_entry_[slot]].second;
+        return entries_[insert_new(key, V{}, hash)].second;
+    }
+
+    void erase(const K& key) {
+        size_t slot = find_slot(key, hash_key(key));
+        if (slot == kNotFound) return;
+        const uint32_t entry = slot_entry_[slot];
+        set_ctrl(slot, kDeleted);
+        ++tombstones_;
+        const uint32_t last = static_cast<uint32_t>(entries_.size() - 1);
+        if (entry != last) {
+            slot_entry_[slot_of_entry(last)] = entry;
+            entries_[entry] = std::move(entries_[last]);
+            hashes_[entry] = hashes_[last];
+        }
+        entries_.pop_back();
+        hashes_.pop_back();
+    }
+
+    auto begin() const { return entries_.begin(); }
+    auto end()   const { return entries_.end(); }
+};
+
+} // namespace mlc::detail
+
+#endif // MLC_CORE_FLAT_HASH_TABLE_HPP
@@ -1,29 +1,31 @@
 #ifndef MLC_CORE_HASHMAP_HPP
 #define MLC_CORE_HASHMAP_HPP
 
-#include <unordered_map>
 #include <cstddef>
 #include <cstdint>
 #include <functional>
 #include <utility>
 #include <memory>
 #include "mlc/core/cow_detach.hpp"
+#include "mlc/core/flat_hash_table.hpp"
 #include "mlc/core/string.hpp"
 #include "mlc/core/array.hpp"
 
 namespace mlc {
 
-// COW (Copy-on-Write) HashMap over std::unordered_map<K,V>.
+// COW (Copy-on-Write) HashMap over detail::FlatHashTable<K,V> (open
+// addressing, SIMD-probed control bytes; see flat_hash_table.hpp).
 // Copying is O(1) via shared_ptr. Mutation triggers detach only when shared.
+// Iteration yields std::pair<K,V> in insertion order (until the first remove).
 // See cow_detach.hpp for thread-safety limits.
 template<typename K, typename V>
 class HashMap {
-    std::shared_ptr<std::unordered_map<K, V>> data_;
+    std::shared_ptr<detail::FlatHashTable<K, V>> data_;
 
     void detach() { cow::detach_shared_buffer(data_); }
 
 public:
-    HashMap() : data_(std::make_shared<std::unordered_map<K, V>>()) {}
+    HashMap() : data_(std::make_shared<detail::FlatHashTable<K, V>>()) {}
 
     HashMap(const HashMap&) = default;
     HashMap& operator=(const HashMap&) = default;
@@ -35,18 +37,23 @@ public:
     bool empty() const  { return data_->empty(); }
 
     bool has(const K& key) const {
-        return data_->find(key) != data_->end();
+        return data_->find(key) != nullptr;
     }
 
     V get(const K& key) const {
-        auto it = data_->find(key);
-        if (it != data_->end()) return it->second;
+        if (const auto* entry = data_->find(key)) return entry->second;
         return V{};
     }
 
+    // One probe where has() followed by get() takes two.
+    V get_or(const K& key, const V& fallback) const {
+        if (const auto* entry = data_->find(key)) return entry->second;
+        return fallback;
+    }
+
     void set(const K& key, const V& value) {
         detach();
-        (*data_)[key] = value;
+        data_->insert_or_assign(key, value);
     }
 
     void remove(const K& key) {
@@ -72,14 +79,22 @@ public:
     auto end()   const { return data_->end(); }
 };
 
+// Free form of HashMap::get_or for MLC extern bindings, which cast it to the
+// by-value signature MLC declares (copying a HashMap shares its table).
+template<typename K, typename V>
+inline V map_get_or(HashMap<K, V> map, K key, V fallback) {
+    return map.get_or(key, fallback);
+}
+
 } // namespace mlc
 
-// Hash support for mlc::String
+// Hash support for mlc::String: hashes the bytes in place (no std::string copy);
+// heap strings reuse the hash cached in their buffer.
 namespace std {
 template<>
 struct hash<mlc::String> {
     size_t operator()(const mlc::String& s) const {
-        return std::hash<std::string>{}(s.as_std_string());
+        return s.hash();
     }
 };
 }
@@ -0,0 +1,296 @@
+#ifndef MLC_CORE_PERSISTENT_MAP_HPP
+#define MLC_CORE_PERSISTENT_MAP_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <utility>
+#include <vector>
+#include "mlc/core/cow_detach.hpp"
+#include "mlc/core/array.hpp"
+#include "mlc/core/hashmap.hpp"
+
+namespace mlc {
+
+// Persistent HashMap: hash array mapped trie (CHAMP layout) with the same
+// surface as mlc::HashMap. Copying is O(1) and never deep-copies later: set()
+// and remove() on a shared map copy only the O(log32 n) nodes on the key's
+// path and keep sharing every other subtree. Nodes owned by a single map are
+// edited in place, so building a map in a loop costs no more than path length.
+// Meant for scoped environments (MLC `PersistentMap<K, V>`) where every child
+// scope forks its parent and adds a few bindings.
+//
+// Each node indexes 5 hash bits: `entry_map` marks slots holding an entry,
+// `child_map` slots holding a subnode, both kept in slot order. After 64 bits
+// a collision node holds the remaining entries in a flat list. remove() pulls
+// a lone remaining entry back into its parent, so equal key sets always have
+// the same shape. Iteration follows hash order (deterministic, not insertion
+// order). Thread-safety is as for HashMap (see cow_detach.hpp).
+template<typename K, typename V, typename Hash = std::hash<K>>
+class PersistentMap {
+    using Entry = std::pair<K, V>;
+
+    static constexpr unsigned kBits = 5;
+    static constexpr unsigned kHashBits = 64;
+    static constexpr size_t kMaxDepth = kHashBits / kBits + 2;
+
+    struct Leaf {
+        Entry entry;
+        uint64_t hash;
+    };
+
+    struct Node;
+    using NodePtr = std::shared_ptr<Node>;
+
+    struct Node {
+        uint32_t entry_map = 0;
+        uint32_t child_map = 0;
+        std::vector<Leaf> leaves;       // collision nodes: unordered, maps unused
+        std::vector<NodePtr> children;
+    };
+
+    NodePtr root_;
+    size_t size_ = 0;
+
+    static uint64_t hash_key(const K& key) {
+        uint64_t h = static_cast<uint64_t>(Hash{}(key)) * 0x9E3779B97F4A7C15ull;
+        return h ^ (h >> 29);
+    }
+
+    static bool is_collision_level(unsigned shift) noexcept { return shift >= kHashBits; }
+    static uint32_t bit_of(uint64_t hash, unsigned shift) noexcept { return 1u << ((hash >> shift) & 31u); }
+    static size_t rank(uint32_t map, uint32_t bit) noexcept {
+        return static_cast<size_t>(__builtin_popcount(map & (bit - 1)));
+    }
+
+    static const Leaf* find_leaf(const Node* node, uint64_t hash, const K& key) {
+        for (unsigned shift = 0; node != nullptr; shift += kBits) {
+            if (is_collision_level(shift)) {
+                for (const Leaf& leaf : node->leaves)
+                    if (leaf.entry.first == key) return &leaf;
+                return nullptr;
+            }
+            const uint32_t bit = bit_of(hash, shift);
+            if (node->entry_map & bit) {
+                const Leaf& leaf = node->leaves[rank(node->entry_map, bit)];
+                return leaf.hash == hash && leaf.entry.first == key ? &leaf : nullptr;
+            }
+            if (!(node->child_map & bit)) return nullptr;
+            node = node->children[rank(node->child_map, bit)].get();
+        }
+        return nullptr;
+    }
+
+    // Node at `shift` holding two leaves with distinct keys.
+    static NodePtr merge_leaves(Leaf first, Leaf second, unsigned shift) {
+        auto node = std::make_shared<Node>();
+        if (is_collision_level(shift)) {
+            node->leaves.push_back(std::move(first));
+            node->leaves.push_back(std::move(second));
+            return node;
+        }
+        const uint32_t first_bit = bit_of(first.hash, shift);
+        const uint32_t second_bit = bit_of(second.hash, shift);
+        if (first_bit == second_bit) {
+            node->child_map = first_bit;
+            node->children.push_back(merge_leaves(std::move(first), std::move(second), shift + kBits));
+            return node;
+        }
+        node->entry_map = first_bit | second_bit;
+        if (second_bit < first_bit) std::swap(first, second);
+        node->leaves.push_back(std::move(first));
+        node->leaves.push_back(std::move(second));
+        return node;
+    }
+
+    // Inserts or assigns below `node` (made unique first); true if the key is new.
+    static bool insert(NodePtr& node, unsigned shift, uint64_t hash, const K& key, const V& value) {
+        cow::detach_shared_buffer(node);
+        if (is_collision_level(shift)) {
+            for (Leaf& leaf : node->leaves)
+                if (leaf.entry.first == key) {
+                    leaf.entry.second = value;
+                    return false;
+                }
+            node->leaves.push_back(Leaf{Entry(key, value), hash});
+            return true;
+        }
+        const uint32_t bit = bit_of(hash, shift);
+        if (node->entry_map & bit) {
+            const size_t position = rank(node->entry_map, bit);
+            Leaf& existing = node->leaves[position];
+            if (existing.hash == hash && existing.entry.first == key) {
+                existing.entry.second = value;
+                return false;
+            }
+            NodePtr child = merge_leaves(std::move(existing), Leaf{Entry(key, value), hash}, shift + kBits);
+            node->leaves.erase(node->leaves.begin() + static_cast<std::ptrdiff_t>(position));
+            node->entry_map &= ~bit;
+            node->child_map |= bit;
+            node->children.insert(
+                node->children.begin() + static_cast<std::ptrdiff_t>(rank(node->child_map, bit)),
+                std::move(child));
+            return true;
+        }
+        if (node->child_map & bit)
+            return insert(node->children[rank(node->child_map, bit)], shift + kBits, hash, key, value);
+        node->entry_map |= bit;
+        node->leaves.insert(
+            node->leaves.begin() + static_cast<std::ptrdiff_t>(rank(node->entry_map, bit)),
+            Leaf{Entry(key, value), hash});
+        return true;
+    }
+
+    static bool is_single_leaf(const Node& node) noexcept {
+        return node.children.empty() && node.leaves.size() == 1;
+    }
+
+    // Removes `key`, which must be present below `node`.
+    static void erase(NodePtr& node, unsigned shift, uint64_t hash, const K& key) {
+        cow::detach_shared_buffer(node);
+        if (is_collision_level(shift)) {
+            for (size_t i = 0; i < node->leaves.size(); ++i)
+                if (node->leaves[i].entry.first == key) {
+                    node->leaves.erase(node->leaves.begin() + static_cast<std::ptrdiff_t>(i));
+                    return;
+                }
+            return;
+        }
+        const uint32_t bit = bit_of(hash, shift);
+        if (node->entry_map & bit) {
+            node->leaves.erase(node->leaves.begin() + static_cast<std::ptrdiff_t>(rank(node->entry_map, bit)));
+            node->entry_map &= ~bit;
+            return;
+        }
+        const size_t child_position = rank(node->child_map, bit);
+        NodePtr& child = node->children[child_position];
+        erase(child, shift + kBits, hash, key);
+        if (!is_single_leaf(*child)) return;
+        Leaf survivor = std::move(child->leaves.front());
+        node->children.erase(node->children.begin() + static_cast<std::ptrdiff_t>(child_position));
+        node->child_map &= ~bit;
+        node->entry_map |= bit;
+        node->leaves.insert(
+            node->leaves.begin() + static_cast<std::ptrdiff_t>(rank(node->entry_map, bit)),
+            std::move(survivor));
+    }
+
+public:
+    // Depth-first walk: a node's own leaves, then its children.
+    class const_iterator {
+        struct Frame {
+            const Node* node;
+            size_t next_leaf;
+            size_t next_child;
+        };
+
+        Frame stack_[kMaxDepth] = {};
+        int depth_ = -1;
+        const Entry* current_ = nullptr;
+
+        void advance() {
+            while (depth_ >= 0) {
+                Frame& frame = stack_[depth_];
+                if (frame.next_leaf < frame.node->leaves.size()) {
+                    current_ = &frame.node->leaves[frame.next_leaf++].entry;
+                    return;
+                }
+                if (frame.next_child < frame.node->children.size()) {
+                    const Node* child = frame.node->children[frame.next_child++].get();
+                    stack_[++depth_] = Frame{child, 0, 0};
+                    continue;
+                }
+                --depth_;
+            }
+            current_ = nullptr;
+        }
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Entry;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const Entry*;
+        using reference = const Entry&;
+
+        const_iterator() = default;
+
+        explicit const_iterator(const Node* root) {
+            if (root == nullptr) return;
+            stack_[0] = Frame{root, 0, 0};
+            depth_ = 0;
+            advance();
+        }
+
+        reference operator*() const { return *current_; }
+        pointer operator->() const { return current_; }
+
+        const_iterator& operator++() {
+            advance();
+            return *this;
+        }
+
+        const_iterator operator++(int) {
+            const_iterator previous = *this;
+            advance();
+            return previous;
+        }
+
+        bool operator==(const const_iterator& other) const noexcept { return current_ == other.current_; }
+        bool operator!=(const const_iterator& other) const noexcept { return current_ != other.current_; }
+    };
+
+    PersistentMap() = default;
+
+    PersistentMap(const PersistentMap&) = default;
+    PersistentMap& operator=(const PersistentMap&) = default;
+    PersistentMap(PersistentMap&&) noexcept = default;
+    PersistentMap& operator=(PersistentMap&&) noexcept = default;
+    ~PersistentMap() = default;
+
+    size_t size() const { return size_; }
+    bool empty() const  { return size_ == 0; }
+
+    bool has(const K& key) const {
+        return find_leaf(root_.get(), hash_key(key), key) != nullptr;
+    }
+
+    V get(const K& key) const {
+        if (const Leaf* leaf = find_leaf(root_.get(), hash_key(key), key)) return leaf->entry.second;
+        return V{};
+    }
+
+    void set(const K& key, const V& value) {
+        if (!root_) root_ = std::make_shared<Node>();
+        if (insert(root_, 0, hash_key(key), key, value)) ++size_;
+    }
+
+    void remove(const K& key) {
+        const uint64_t hash = hash_key(key);
+        if (find_leaf(root_.get(), hash, key) == nullptr) return;
+        erase(root_, 0, hash, key);
+        --size_;
+    }
+
+    mlc::Array<K> keys() const {
+        mlc::Array<K> result;
+        for (const auto& [k, v] : *this)
+            result.push_back(k);
+        return result;
+    }
+
+    mlc::Array<V> values() const {
+        mlc::Array<V> result;
+        for (const auto& [k, v] : *this)
+            result.push_back(v);
+        return result;
+    }
+
+    const_iterator begin() const { return const_iterator(root_.get()); }
+    const_iterator end()   const { return const_iterator(); }
+};
+
+} // namespace mlc
+
+#endif // MLC_CORE_PERSISTENT_MAP_HPP
@@ -0,0 +1,68 @@
+#pragma once
+
+// Canonical Shared<T> leaves for the checker. MLC never writes through a
+// Shared<T>, so a field-less type such as TUnknown or TI32 needs only one
+// node per process. compiler/checker/registry_type.mlc wraps shared_leaf as
+// type_unknown(), type_i32(), ...; everything else still allocates with
+// Shared.new. shared_same lets type equality short-circuit on identity.
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+namespace mlc {
+
+// True when alternative Index of Variant has no fields (std::is_empty_v):
+// every value of it is the same, so one node can stand for all of them.
+template <typename Variant, std::size_t Index>
+inline constexpr bool is_leaf_alternative_v =
+    std::is_empty_v<std::variant_alternative_t<Index, Variant>> &&
+    std::is_default_constructible_v<std::variant_alternative_t<Index, Variant>>;
+
+template <typename Variant, std::size_t... Index>
+constexpr bool has_leaf_alternative(std::index_sequence<Index...>) {
+    return (is_leaf_alternative_v<Variant, Index> || ...);
+}
+
+// The canonical node for alternative Index, or nullptr when the alternative
+// has fields: those have no single value to share.
+template <typename Variant, std::size_t Index>
+inline std::shared_ptr<Variant> make_leaf_node() {
+    if constexpr (is_leaf_alternative_v<Variant, Index>) {
+        return std::make_shared<Variant>(std::in_place_index<Index>);
+    } else {
+        return nullptr;
+    }
+}
+
+template <typename Variant, std::size_t... Index>
+inline std::array<std::shared_ptr<Variant>, sizeof...(Index)>
+make_leaf_nodes(std::index_sequence<Index...>) {
+    return {make_leaf_node<Variant, Index>()...};
+}
+
+// The shared node for value's alternative when that alternative is empty;
+// otherwise a fresh node holding value, exactly as std::make_shared would.
+// Only field-less alternatives are ever shared: structurally equal composite
+// values (TArray(i32), TNamed("x"), ...) still get distinct nodes. Parameters
+// here and in shared_same are by value, the signature extern bindings cast to.
+template <typename Variant>
+inline std::shared_ptr<Variant> shared_leaf(Variant value) {
+    using Indices = std::make_index_sequence<std::variant_size_v<Variant>>;
+    static_assert(has_leaf_alternative<Variant>(Indices{}),
+                  "shared_leaf: Variant has no field-less alternative to share");
+    // Function-local static: initialised once, thread-safe (C++11 magic statics).
+    static const auto nodes = make_leaf_nodes<Variant>(Indices{});
+    const std::shared_ptr<Variant>& node = nodes[value.index()];
+    return node ? node : std::make_shared<Variant>(std::move(value));
+}
+
+template <typename T>
+inline bool shared_same(std::shared_ptr<T> left, std::shared_ptr<T> right) {
+    return left.get() == right.get();
+}
+
+} // namespace mlc
@@ -10,6 +10,10 @@
 #include <sstream>
 #include <utility>
 #include <memory>
+#include <atomic>
+#include <algorithm>
+#include <cstdlib>
+#include <new>
 #include "mlc/core/array.hpp"
 
 namespace mlc {
@@ -17,17 +21,99 @@ namespace mlc {
 // Forward declarations
 class Bytes;
 
+namespace detail {
+
+// Heap storage behind mlc::String: refcount, size, capacity and the bytes in
+// a single allocation (bytes follow the header, NUL-terminated). The refcount
+// is atomic so strings can be shared across threads; a buffer is only ever
+// written while its count is 1. `hash` caches the hash of the bytes (0 = not
+// computed yet), so every copy of a string hashes it once; writes reset it.
+struct StringBuffer {
+    uint32_t refs;
+    size_t   size;
+    size_t   capacity;  // excludes the terminator
+    size_t   hash;
+
+    char*       data()       noexcept { return reinterpret_cast<char*>(this + 1); }
+    const char* data() const noexcept { return reinterpret_cast<const char*>(this + 1); }
+
+    static StringBuffer* allocate(size_t capacity) {
+        void* memory = std::malloc(sizeof(StringBuffer) + capacity + 1);
+        if (!memory) throw std::bad_alloc();
+        auto* buffer = static_cast<StringBuffer*>(memory);
+        buffer->refs = 1;
+        buffer->size = 0;
+        buffer->capacity = capacity;
+        buffer->hash = 0;
+        buffer->data()[0] = '\0';
+        return buffer;
+    }
+
+    static StringBuffer* create(const char* bytes, size_t len) {
+        StringBuffer* buffer = allocate(len);
+        std::memcpy(buffer->data(), bytes, len);
+        buffer->set_size(len);
+        return buffer;
+    }
+
+    // Unique owner only: grows to at least `min_capacity`, doubling so a run of
+    // appends is amortized O(1). May move the buffer.
+    static StringBuffer* reserve(StringBuffer* buffer, size_t min_capacity) {
+        if (buffer->capacity >= min_capacity) return buffer;
+        size_t capacity = std::max(min_capacity, buffer->capacity * 2);
+        void* memory = std::realloc(buffer, sizeof(StringBuffer) + capacity + 1);
+        if (!memory) throw std::bad_alloc();
+        buffer = static_cast<StringBuffer*>(memory);
+        buffer->capacity = capacity;
+        return buffer;
+    }
+
+    void set_size(size_t new_size) noexcept {
+        size = new_size;
+        hash = 0;
+        data()[new_size] = '\0';
+    }
+
+    // Readers on several threads may race to fill the cache; they store the
+    // same value.
+    size_t cached_hash() const noexcept {
+        std::atomic_ref<size_t> slot(const_cast<size_t&>(hash));
+        size_t value = slot.load(std::memory_order_relaxed);
+        if (value == 0) {
+            value = std::hash<std::string_view>{}(std::string_view(data(), size));
+            slot.store(value, std::memory_order_relaxed);
+        }
+        return value;
+    }
+
+    void retain() noexcept { std::atomic_ref<uint32_t>(refs).fetch_add(1, std::memory_order_relaxed); }
+
+    void release() noexcept {
+        if (std::atomic_ref<uint32_t>(refs).fetch_sub(1, std::memory_order_acq_rel) == 1) std::free(this);
+    }
+
+    bool is_unique() const noexcept {
+        return std::atomic_ref<uint32_t>(const_cast<uint32_t&>(refs)).load(std::memory_order_acquire) == 1;
+    }
+};
+
+} // namespace detail
+
 // mlc::String — UTF-8 string.
 // Strings ≤ 22 bytes are stored inline (SSO), no heap allocation.
-// Strings > 22 bytes are stored via shared_ptr for O(1) copy.
+// Strings > 22 bytes live in one refcounted detail::StringBuffer for O(1) copy;
+// +=, and replace/repeat on temporaries, write into it in place while it is
+// uniquely owned.
 // UTF-8 is not re-encoded; SSO only affects storage.
 class String {
+    friend class StringBuilder;
+
     static constexpr size_t SSO_CAPACITY = 22;
 
-    std::shared_ptr<std::string> heap_;  // null in SSO mode
-    char    sso_buf_[SSO_CAPACITY + 1];  // inline buffer (+1 for '\0'); valid in SSO mode
-    uint8_t sso_len_;                    // byte length in SSO mode (0..22)
-    bool    is_ascii_;                   // cached: all bytes < 0x80
+    detail::StringBuffer* heap_ = nullptr;  // null in SSO mode
+    char    sso_buf_[SSO_CAPACITY + 1];     // inline buffer (+1 for '\0'); valid in SSO mode
+    uint8_t sso_len_;                       // byte length in SSO mode (0..22)
+    bool    is_ascii_;                      // cached: all bytes < 0x80
 
     // ── internal helpers ──────────────────────────────────────────────────────
 
@@ -44,28 +130,60 @@ class String {
             sso_buf_[len] = '\0';
             sso_len_ = static_cast<uint8_t>(len);
         } else {
-            heap_ = std::make_shared<std::string>(data, len);
+            heap_ = detail::StringBuffer::create(data, len);
             sso_len_ = 0;
         }
     }
 
+    void copy_from(const String& other) noexcept {
+        heap_ = other.heap_;
+        sso_len_ = other.sso_len_;
+        is_ascii_ = other.is_ascii_;
+        if (heap_) heap_->retain();
+        else std::memcpy(sso_buf_, other.sso_buf_, static_cast<size_t>(sso_len_) + 1);
+    }
+
+    void move_from(String& other) noexcept {
+        heap_ = other.heap_;
+        sso_len_ = other.sso_len_;
+        is_ascii_ = other.is_ascii_;
+        if (!heap_) std::memcpy(sso_buf_, other.sso_buf_, static_cast<size_t>(sso_len_) + 1);
+        other.heap_ = nullptr;
+        other.sso_len_ = 0;
+        other.sso_buf_[0] = '\0';
+        other.is_ascii_ = true;
+    }
+
+    bool owns_unique_buffer() const noexcept { return heap_ && heap_->is_unique(); }
+
+    // Makes this string the unique owner of a heap buffer holding its current
+    // bytes with room for at least `capacity`. Shared and SSO contents are
+    // copied once; a unique buffer only grows.
+    void reserve_unique(size_t capacity) {
+        if (owns_unique_buffer()) {
+            heap_ = detail::StringBuffer::reserve(heap_, capacity);
+            return;
+        }
+        auto v = view();
+        detail::StringBuffer* buffer = detail::StringBuffer::allocate(std::max(capacity, v.size()));
+        std::memcpy(buffer->data(), v.data(), v.size());
+        buffer->set_size(v.size());
+        if (heap_) heap_->release();
+        heap_ = buffer;
+        sso_len_ = 0;
+    }
+
     // Private constructors for known-ascii strings (avoid re-scanning)
     String(const char* data, size_t len, bool ascii) : sso_len_(0), is_ascii_(ascii) {
         init(data, len, ascii);
     }
 
     String(std::string&& s, bool ascii) : sso_len_(0), is_ascii_(ascii) {
-        if (s.size() <= SSO_CAPACITY) {
-            std::memcpy(sso_buf_, s.data(), s.size());
-            sso_buf_[s.size()] = '\0';
-            sso_len_ = static_cast<uint8_t>(s.size());
-        } else {
-            heap_ = std::make_shared<std::string>(std::move(s));
-        }
+        init(s.data(), s.size(), ascii);
     }
 
-    String(std::shared_ptr<std::string> h, bool ascii)
-        : heap_(std::move(h)), sso_len_(0), is_ascii_(ascii) {}
+    // Adopts `buffer` (refcount already 1 for this string).
+    String(detail::StringBuffer* buffer, bool ascii) : heap_(buffer), sso_len_(0), is_ascii_(ascii) {}
 
     // UTF-8 helpers (implemented in string.cpp)
     static size_t      utf8_length(std::string_view str) noexcept;
@@ -92,38 +210,48 @@ public:
     }
 
     String(std::string&& str) : sso_len_(0), is_ascii_(true) {
-        bool ascii = check_ascii(str.data(), str.size());
-        if (str.size() <= SSO_CAPACITY) {
-            std::memcpy(sso_buf_, str.data(), str.size());
-            sso_buf_[str.size()] = '\0';
-            sso_len_ = static_cast<uint8_t>(str.size());
-            is_ascii_ = ascii;
-        } else {
-            heap_ = std::make_shared<std::string>(std::move(str));
-            is_ascii_ = ascii;
+        init(str.data(), str.size(), check_ascii(str.data(), str.size()));
+    }
+
+    // Copy: SSO copies the inline bytes (no heap); heap bumps the refcount — both O(1)
+    String(const String& other) noexcept { copy_from(other); }
+    String(String&& other) noexcept { move_from(other); }
+
+    String& operator=(const String& other) noexcept {
+        if (this != &other) {
+            if (heap_) heap_->release();
+            copy_from(other);
+        }
+        return *this;
+    }
+
+    String& operator=(String&& other) noexcept {
+        if (this != &other) {
+            if (heap_) heap_->release();
+            move_from(other);
         }
+        return *this;
     }
 
-    // Copy: SSO copies 48 bytes inline (no heap); heap increments refcount — both O(1)
-    String(const String&) = default;
-    String(String&&) noexcept = default;
-    String& operator=(const String&) = default;
-    String& operator=(String&&) noexcept = default;
+    ~String() { if (heap_) heap_->release(); }
 
     // ── raw access ────────────────────────────────────────────────────────────
 
     bool    is_sso()    const noexcept { return !heap_; }
     const char* raw_data() const noexcept { return is_sso() ? sso_buf_ : heap_->data(); }
-    size_t      raw_size() const noexcept { return is_sso() ? sso_len_ : heap_->size(); }
+    size_t      raw_size() const noexcept { return is_sso() ? sso_len_ : heap_->size; }
 
     // Zero-copy view — preferred read-only accessor
     std::string_view view() const noexcept { return {raw_data(), raw_size()}; }
 
-    // For C++ interop. Constructs std::string for SSO strings (copy of ≤22 bytes).
-    std::string as_std_string() const {
-        return is_sso() ? std::string(sso_buf_, sso_len_) : *heap_;
+    // std::hash of the bytes; computed once per heap buffer, then cached.
+    size_t hash() const noexcept {
+        return heap_ ? heap_->cached_hash() : std::hash<std::string_view>{}(view());
     }
 
+    // For C++ interop. Constructs a std::string copy of the bytes.
+    std::string as_std_string() const { return std::string(raw_data(), raw_size()); }
+
     // c_str() is valid: sso_buf_ is always null-terminated at sso_len_
     const char* c_str() const noexcept { return raw_data(); }
 
@@ -141,6 +269,13 @@ public:
         return String(raw_data() + i, 1, true);
     }
 
+    // O(1) byte value (0..255) at `index`, or -1 outside the string. Lets a
+    // scanner classify bytes as integers without building a String per byte.
+    int byte_code(int index) const noexcept {
+        if (index < 0 || static_cast<size_t>(index) >= raw_size()) return -1;
+        return static_cast<unsigned char>(raw_data()[index]);
+    }
+
     // O(1) byte-indexed substring — always uses raw byte offsets
     String byte_substring(int start, int length) const {
         size_t s = static_cast<size_t>(start);
@@ -226,24 +361,93 @@ public:
         return static_cast<int32_t>(utf8_length(v.substr(0, pos)));
     }
 
-    String replace(const String& old_str, const String& new_str) const {
-        std::string result(view());
+    String replace(const String& old_str, const String& new_str) const& {
+        String result(*this);
+        return std::move(result).replace(old_str, new_str);
+    }
+
+    // On a temporary that owns its buffer alone, rewrites the bytes in place
+    // (growing the buffer when the replacement is longer).
+    String replace(const String& old_str, const String& new_str) && {
         auto ov = old_str.view(), nv = new_str.view();
-        size_t pos = 0;
-        while ((pos = result.find(ov, pos)) != std::string::npos) {
-            result.replace(pos, ov.size(), nv);
-            pos += nv.size();
+        auto v = view();
+        if (ov.empty() || v.size() < ov.size()) return std::move(*this);
+        std::vector<size_t> matches;
+        for (size_t pos = v.find(ov); pos != std::string_view::npos; pos = v.find(ov, pos + ov.size()))
+            matches.push_back(pos);
+        if (matches.empty()) return std::move(*this);
+        bool ascii = is_ascii_ && new_str.is_ascii_;
+        size_t new_size = v.size() - matches.size() * ov.size() + matches.size() * nv.size();
+        if (&old_str == this || &new_str == this || (!owns_unique_buffer() && new_size <= SSO_CAPACITY)) {
+            std::string result;
+            result.reserve(new_size);
+            size_t from = 0;
+            for (size_t pos : matches) {
+                result.append(v.substr(from, pos - from));
+                result.append(nv);
+                from = pos + ov.size();
+            }
+            result.append(v.substr(from));
+            return String(std::move(result), ascii);
         }
-        return String(std::move(result));
+        size_t old_size = v.size();
+        reserve_unique(std::max(new_size, old_size));
+        char* bytes = heap_->data();
+        if (nv.size() <= ov.size()) {
+            size_t write = matches[0], from = matches[0];
+            for (size_t i = 0; i < matches.size(); ++i) {
+                size_t next = i + 1 < matches.size() ? matches[i + 1] : old_size;
+                std::memcpy(bytes + write, nv.data(), nv.size());
+                write += nv.size();
+                from = matches[i] + ov.size();
+                std::memmove(bytes + write, bytes + from, next - from);
+                write += next - from;
+            }
+        } else {
+            size_t write_end = new_size, from_end = old_size;
+            for (size_t i = matches.size(); i-- > 0;) {
+                size_t tail = from_end - (matches[i] + ov.size());
+                write_end -= tail;
+                std::memmove(bytes + write_end, bytes + matches[i] + ov.size(), tail);
+                write_end -= nv.size();
+                std::memcpy(bytes + write_end, nv.data(), nv.size());
+                from_end = matches[i];
+            }
+        }
+        heap_->set_size(new_size);
+        is_ascii_ = ascii;
+        return std::move(*this);
+    }
+
+    String repeat(int32_t n) const& {
+        String result(*this);
+        return std::move(result).repeat(n);
     }
 
-    String repeat(int32_t n) const {
+    // On a temporary that owns its buffer alone, grows it and doubles the
+    // bytes in place.
+    String repeat(int32_t n) && {
         if (n <= 0) return String("");
-        auto v = view();
-        std::string result;
-        result.reserve(v.size() * static_cast<size_t>(n));
-        for (int32_t i = 0; i < n; ++i) result.append(v);
-        return String(std::move(result));
+        size_t unit = raw_size();
+        size_t total = unit * static_cast<size_t>(n);
+        if (n == 1 || unit == 0) return std::move(*this);
+        if (is_sso() && total <= SSO_CAPACITY) {
+            for (size_t filled = unit; filled < total; filled += unit)
+                std::memcpy(sso_buf_ + filled, sso_buf_, unit);
+            sso_buf_[total] = '\0';
+            sso_len_ = static_cast<uint8_t>(total);
+            return std::move(*this);
+        }
+        reserve_unique(total);
+        char* bytes = heap_->data();
+        size_t filled = unit;
+        while (filled < total) {
+            size_t chunk = std::min(filled, total - filled);
+            std::memcpy(bytes + filled, bytes, chunk);
+            filled += chunk;
+        }
+        heap_->set_size(total);
+        return std::move(*this);
     }
 
     String reverse() const {
@@ -369,21 +573,46 @@ public:
             result.is_ascii_ = ascii;
             return result;
         }
-        std::string s;
-        s.reserve(total);
-        s.append(av);
-        s.append(bv);
-        return String(std::move(s), ascii);
+        detail::StringBuffer* buffer = detail::StringBuffer::allocate(total);
+        std::memcpy(buffer->data(), av.data(), av.size());
+        std::memcpy(buffer->data() + av.size(), bv.data(), bv.size());
+        buffer->set_size(total);
+        return String(buffer, ascii);
     }
 
+    // Appends in place while this string is the sole owner of its heap buffer,
+    // growing it geometrically, so a loop of `s += piece` is amortized O(1) per
+    // byte. SSO and shared strings move to a fresh unique buffer first.
     String& operator+=(const String& other) {
-        *this = *this + other;
+        auto bv = other.view();
+        size_t size = raw_size();
+        size_t total = size + bv.size();
+        if (is_sso() && total <= SSO_CAPACITY) {
+            std::memmove(sso_buf_ + size, bv.data(), bv.size());
+            sso_buf_[total] = '\0';
+            sso_len_ = static_cast<uint8_t>(total);
+        } else if (&other == this || (heap_ && other.heap_ == heap_)) {
+            *this = *this + other;
+            return *this;
+        } else {
+            reserve_unique(total);
+            std::memcpy(heap_->data() + size, bv.data(), bv.size());
+            heap_->set_size(total);
+        }
+        is_ascii_ = is_ascii_ && other.is_ascii_;
         return *this;
     }
 
+    // `a + b + c` reuses the temporary on the left instead of copying it again.
+    friend String operator+(String&& lhs, const String& rhs) {
+        lhs += rhs;
+        return std::move(lhs);
+    }
+
     // ── comparison ────────────────────────────────────────────────────────────
 
-    bool operator==(const String& o) const noexcept { return view() == o.view(); }
+    // Copies of one heap string (e.g. interned identifiers) compare by pointer.
+    bool operator==(const String& o) const noexcept { return (heap_ && heap_ == o.heap_) || view() == o.view(); }
     bool operator!=(const String& o) const noexcept { return view() != o.view(); }
     bool operator< (const String& o) const noexcept { return view() <  o.view(); }
     bool operator> (const String& o) const noexcept { return view() >  o.view(); }
@@ -495,6 +724,56 @@ inline String to_string_i32(int32_t value) { return to_string(value); }
 inline String to_string_f32(float value)   { return to_string(value); }
 inline String to_string_bool(bool value)   { return to_string(value); }
 
+// UTF-8 encoding of one code point; surrogates and out-of-range values give U+FFFD.
+inline String utf8_from_code_point(int32_t code_point) {
+    if (code_point < 0 || code_point > 0x10FFFF || (code_point >= 0xD800 && code_point <= 0xDFFF)) code_point = 0xFFFD;
+    const auto value = static_cast<uint32_t>(code_point);
+    std::string bytes;
+    if (value < 0x80) {
+        bytes += static_cast<char>(value);
+    } else if (value < 0x800) {
+        bytes += static_cast<char>(0xC0 | (value >> 6));
+        bytes += static_cast<char>(0x80 | (value & 0x3F));
+    } else if (value < 0x10000) {
+        bytes += static_cast<char>(0xE0 | (value >> 12));
+        bytes += static_cast<char>(0x80 | ((value >> 6) & 0x3F));
+        bytes += static_cast<char>(0x80 | (value & 0x3F));
+    } else {
+        bytes += static_cast<char>(0xF0 | (value >> 18));
+        bytes += static_cast<char>(0x80 | ((value >> 12) & 0x3F));
+        bytes += static_cast<char>(0x80 | ((value >> 6) & 0x3F));
+        bytes += static_cast<char>(0x80 | (value & 0x3F));
+    }
+    return String(bytes);
+}
+
+// hash() folded to a non-negative int32, for MLC code that keeps its own
+// open-addressing index (compiler/vm/map_index.mlc). Heap strings reuse the
+// cached hash. By value, as its extern binding declares.
+inline int32_t string_hash_i32(String s) noexcept {
+    const auto h = static_cast<uint64_t>(s.hash());
+    return static_cast<int32_t>((h ^ (h >> 32)) & 0x7fffffffu);
+}
+
+// 64-bit FNV-1a over the string bytes as 16 lowercase hex digits. For content
+// fingerprints that decide whether work may be skipped
+// (compiler/driver/module_index.mlc), where 31 bits collide too readily.
+// Not derived from hash(): digests are stored on disk, and std::hash may
+// differ between standard libraries. By value, as its extern binding declares.
+inline String string_digest_hex(String s) {
+    uint64_t h = 14695981039346656037ull;
+    for (const char c : s.view()) {
+        h ^= static_cast<unsigned char>(c);
+        h *= 1099511628211ull;
+    }
+    char digits[16];
+    for (int index = 15; index >= 0; --index) {
+        digits[index] = "0123456789abcdef"[h & 0xfu];
+        h >>= 4;
+    }
+    return String(digits, sizeof(digits));
+}
+
 inline String format(const String& fmt, const std::vector<String>& parts) {
     auto pattern = fmt.view();
     std::string result;
@@ -0,0 +1,86 @@
+#ifndef MLC_STRING_BUILDER_HPP
+#define MLC_STRING_BUILDER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include "mlc/core/string.hpp"
+
+namespace mlc {
+
+// mlc::StringBuilder — growable byte buffer for assembling large strings.
+// The bytes accumulate in a uniquely owned String buffer that grows
+// geometrically, so append() is amortized O(1) per byte and finish() hands
+// that buffer over without copying it. Copies of a builder share one buffer
+// (a handle, like Channel), so MLC code can pass it to helper functions by
+// value and keep appending. Not thread-safe: keep a builder on the thread that
+// fills it.
+class StringBuilder {
+    struct State {
+        String text;
+    };
+
+    std::shared_ptr<State> state_;
+
+public:
+    StringBuilder() : state_(std::make_shared<State>()) {}
+
+    explicit StringBuilder(size_t capacity) : state_(std::make_shared<State>()) {
+        if (capacity > String::SSO_CAPACITY) state_->text.reserve_unique(capacity);
+    }
+
+    void append(const String& piece) const { state_->text += piece; }
+
+    void append_line(const String& piece) const {
+        state_->text += piece;
+        state_->text += String("\n", 1, true);
+    }
+
+    int    length()   const noexcept { return state_->text.byte_size(); }
+    size_t size()     const noexcept { return state_->text.size(); }
+    bool   is_empty() const noexcept { return state_->text.is_empty(); }
+
+    // Snapshot of the contents so far; the builder keeps them. The next
+    // append then starts a fresh buffer instead of writing into the snapshot.
+    String to_string() const { return state_->text; }
+
+    // Moves the buffer into the result and leaves every handle to this
+    // builder empty. A short result drops a reserved buffer for SSO.
+    String finish() const {
+        String result = std::move(state_->text);
+        if (!result.is_sso() && result.raw_size() <= String::SSO_CAPACITY)
+            return String(result.raw_data(), result.raw_size(), result.is_ascii_);
+        return result;
+    }
+};
+
+// ── FFI surface (compiler/infrastructure/string_builder.mlc) ─────────────────
+// Parameters are by value: extern bindings cast to exactly that signature.
+
+inline StringBuilder string_builder_new() { return StringBuilder(); }
+
+inline StringBuilder string_builder_with_capacity(int32_t capacity) {
+    return StringBuilder(capacity > 0 ? static_cast<size_t>(capacity) : 0);
+}
+
+inline void string_builder_append(StringBuilder builder, String piece) {
+    builder.append(piece);
+}
+
+inline void string_builder_append_line(StringBuilder builder, String piece) {
+    builder.append_line(piece);
+}
+
+inline int32_t string_builder_length(StringBuilder builder) noexcept {
+    return builder.length();
+}
+
+inline String string_builder_to_string(StringBuilder builder) { return builder.to_string(); }
+
+inline String string_builder_finish(StringBuilder builder) { return builder.finish(); }
+
+} // namespace mlc
+
+#endif // MLC_STRING_BUILDER_HPP
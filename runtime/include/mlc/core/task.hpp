@@ -1,5 +1,6 @@
 #pragma once
 
+#include <atomic>
 #include <coroutine>
 #include <exception>
 #include <variant>
@@ -19,6 +20,7 @@ template<typename T>
 struct TaskPromise {
     std::variant<std::monostate, T, std::exception_ptr> result;
     std::coroutine_handle<> continuation;
+    const std::atomic<bool>* finished = nullptr; // see Task::track_completion
 
     Task<T> get_return_object();
 
@@ -61,6 +63,7 @@ template<>
 struct TaskPromise<void> {
     std::optional<std::exception_ptr> exception;
     std::coroutine_handle<> continuation;
+    const std::atomic<bool>* finished = nullptr; // see Task::track_completion
 
     Task<void> get_return_object();
 
@@ -155,9 +158,19 @@ public:
         return Awaiter{handle_};
     }
 
-    // Check if task is ready (completed)
+    // Check if task is ready (completed, or its tracked work has finished)
     bool is_ready() const noexcept {
-        return handle_ && handle_.done();
+        if (!handle_) return false;
+        if (handle_.done()) return true;
+        const std::atomic<bool>* finished = handle_.promise().finished;
+        return finished != nullptr && finished->load(std::memory_order_acquire);
+    }
+
+    // For a task whose body only collects work running elsewhere (spawn_task):
+    // is_ready reports `finished` so callers can poll without resuming the task.
+    // `finished` must outlive the coroutine frame (the frame owns it in spawn).
+    void track_completion(const std::atomic<bool>* finished) noexcept {
+        if (handle_) handle_.promise().finished = finished;
     }
 
     // Resume the coroutine (run until next suspension point)
@@ -237,7 +250,14 @@ public:
     }
 
     bool is_ready() const noexcept {
-        return handle_ && handle_.done();
+        if (!handle_) return false;
+        if (handle_.done()) return true;
+        const std::atomic<bool>* finished = handle_.promise().finished;
+        return finished != nullptr && finished->load(std::memory_order_acquire);
+    }
+
+    void track_completion(const std::atomic<bool>* finished) noexcept {
+        if (handle_) handle_.promise().finished = finished;
     }
 
     void resume() {
@@ -5,6 +5,7 @@
 
 #include "mlc/io/file.hpp"
 #include <cstdint>
+#include <string>
 #include <system_error>
 
 namespace mlc {
@@ -102,5 +103,19 @@ inline String make_temp_directory_value(String prefix) {
   return make_temp_directory(prefix);
 }
 
+// Path, byte size and modification time of the running executable, or "" when
+// /proc/self/exe is unavailable. On-disk caches keyed on it (the mlcc module
+// index) do not outlive a rebuild of the tool that wrote them.
+inline String executable_stamp_value() {
+  try {
+    const auto executable = std::filesystem::read_symlink("/proc/self/exe");
+    const auto size = std::filesystem::file_size(executable);
+    const auto modified = std::filesystem::last_write_time(executable).time_since_epoch().count();
+    return String(executable.string() + ":" + std::to_string(size) + ":" + std::to_string(modified));
+  } catch (...) {
+    return String("");
+  }
+}
+
 } // namespace file
 } // namespace mlc
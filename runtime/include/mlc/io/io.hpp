@@ -34,6 +34,9 @@ inline int eprintln(const T& v) { return eprintln(mlc::to_string(v)); }
 // I/O functions
 String read_line();
 String read_all();
+// Exactly `count` bytes from stdin (fewer at end of input); for
+// length-prefixed protocols whose payload is not newline-terminated.
+String read_bytes(int32_t count);
 
 // Command line arguments
 Array<String> args();
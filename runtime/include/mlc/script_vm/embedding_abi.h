@@ -53,6 +53,21 @@ MlcResult mlc_vm_call(
 );
 void mlc_handle_release(MlcVm* vm, MlcHandle handle);
 
+/* Heap counters summed over every mlc_vm_call on this VM. Allocation rate is
+   allocated_bytes / call_time_us (bytes per microsecond of call time). */
+typedef struct MlcVmHeapStats {
+  uint64_t calls;
+  uint64_t call_time_us;
+  uint64_t allocated_objects;
+  uint64_t allocated_bytes;
+  uint64_t minor_collections;
+  uint64_t gc_pause_total_us;
+  uint64_t gc_pause_max_us;
+  uint64_t write_barrier_hits;
+} MlcVmHeapStats;
+
+MlcResult mlc_vm_heap_stats(MlcVm* vm, MlcVmHeapStats* out);
+
 /* Test helper: fill buffer with frozen add1 module blob; returns byte size. */
 size_t mlc_script_vm_fixture_add1(uint8_t* out, size_t capacity);
 
@@ -0,0 +1,126 @@
+#pragma once
+
+// TRACK_MLC_SCRIPT_VM §103i — native threaded-code backend for the embedding ABI.
+// Pre-decodes an MLSC module blob once (per mlc_vm_load_module) into a flat
+// per-proto instruction array with resolved constant indices, absolute jump
+// targets and upvalue source lists, then dispatches it with computed goto
+// (GCC/Clang) or a switch jump table. Semantics mirror
+// script_vm/interpreter.mlc execute_program, which remains the reference:
+// same opcode subset, same run_err_* kinds and error positions.
+// The blob must already have passed embedding::emb_verify_module_ptr.
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace mlc {
+namespace script_vm {
+
+// One-to-one with interpreter.mlc run_err_* strings.
+enum class ThreadedRunError : std::int32_t {
+  none = 0,
+  verify,
+  type,
+  overflow,
+  div_zero,
+  no_return,
+  unsupported_opcode,
+  bounds,
+  stack,
+};
+
+enum class ThreadedOp : std::uint8_t {
+  load_const = 0,
+  move,
+  add,
+  sub,
+  ret,
+  jump,
+  jump_if_false,
+  le,
+  call,
+  make_closure,
+  get_upval,
+  set_upval,
+  // Decode-time resolutions of instructions that always fail when reached.
+  type_error,
+  unsupported,
+  fall_off,
+  count,
+};
+
+struct ThreadedInsn {
+  ThreadedOp op = ThreadedOp::unsupported;
+  std::uint8_t a = 0;
+  std::uint8_t b = 0;
+  std::uint8_t c = 0;
+  // load_const: constant index; jump / jump_if_false: target insn index;
+  // make_closure: first entry in ThreadedProto::upvalue_sources.
+  std::int32_t operand = 0;
+  // Primary word index in the original stream (error position).
+  std::int32_t word_index = 0;
+};
+
+struct ThreadedUpvalueSource {
+  std::int32_t is_local = 0;
+  std::int32_t index = 0;
+};
+
+struct ThreadedProto {
+  std::int32_t register_count = 0;
+  std::int32_t word_count = 0;
+  // Always terminated by a fall_off sentinel at word_count.
+  std::vector<ThreadedInsn> code;
+  std::vector<std::int64_t> constants;
+  std::vector<ThreadedUpvalueSource> upvalue_sources;
+};
+
+struct ThreadedExport {
+  std::string name;
+  std::int32_t proto_index = 0;
+};
+
+struct ThreadedModule {
+  std::vector<ThreadedExport> exports;
+  std::vector<ThreadedProto> protos;
+};
+
+// Per-call counters of the generational heap (heap.mlc Heap stats fields).
+struct ThreadedHeapStats {
+  std::uint64_t allocated_objects = 0;
+  std::uint64_t allocated_bytes = 0;
+  std::uint64_t minor_collections = 0;
+  std::uint64_t gc_pause_total_us = 0;
+  std::uint64_t gc_pause_max_us = 0;
+  std::uint64_t write_barrier_hits = 0;
+};
+
+struct ThreadedCallResult {
+  ThreadedRunError error = ThreadedRunError::none;
+  std::int32_t error_at = 0;
+  std::int64_t raw = 0;
+  ThreadedHeapStats heap_stats;
+};
+
+// nullptr when the blob is malformed (embedding.mlc decode_module would not
+// return emb_ok for it).
+std::shared_ptr<const ThreadedModule> threaded_module_decode(
+    const std::uint8_t* bytes, std::size_t size);
+
+// First export with this name, or -1 (embedding.mlc find_export_proto).
+std::int32_t threaded_module_find_export(
+    const ThreadedModule& module, const std::string& export_name);
+
+// Fresh heap per call, like emb_call_export_bytes → run_program_with_args.
+// Minor collections run at the make_closure safepoint once the nursery holds
+// heap_nursery_limit objects; the call-scoped heap never needs a major one.
+ThreadedCallResult threaded_call(
+    const ThreadedModule& module,
+    std::int32_t proto_index,
+    const std::int64_t* args,
+    std::size_t argc);
+
+}  // namespace script_vm
+}  // namespace mlc
@@ -41,6 +41,16 @@ String read_line() {
     return String(line);
 }
 
+String read_bytes(int32_t count) {
+    if (count <= 0) {
+        return String("");
+    }
+    std::string bytes(static_cast<size_t>(count), '\0');
+    std::cin.read(bytes.data(), count);
+    bytes.resize(static_cast<size_t>(std::cin.gcount()));
+    return String(bytes);
+}
+
 String read_all() {
     std::ostringstream oss;
     oss << std::cin.rdbuf();
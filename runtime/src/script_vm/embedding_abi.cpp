@@ -1,29 +1,40 @@
-// TRACK_MLC_SCRIPT_VM §103i — C ABI bridge (calls MLC embedding::* — no opcode twin).
+// TRACK_MLC_SCRIPT_VM §103i — C ABI bridge. Load verifies through MLC
+// embedding::*; calls run the pre-decoded module on the native threaded
+// backend (threaded_dispatch.cpp), whose semantics twin execute_program.
 #include "mlc/script_vm/embedding_abi.h"
+#include "mlc/script_vm/threaded_dispatch.hpp"
 
 #include "embedding.hpp"
 
+#include <algorithm>
+#include <chrono>
 #include <cstdint>
 #include <cstring>
+#include <memory>
 #include <string>
 #include <unordered_map>
 #include <vector>
 
 namespace {
 
+using mlc::script_vm::ThreadedModule;
+using mlc::script_vm::ThreadedRunError;
+
 struct HandleSlot {
   bool live = false;
   std::string module_name;
   std::string export_name;
-  std::vector<std::uint8_t> blob;
+  std::shared_ptr<const ThreadedModule> module;
+  std::int32_t proto_index = -1;
 };
 
 struct EmbeddingVmState {
   std::uint64_t instruction_limit = 0;
   std::int32_t heap_limit_objects = 1000000;
   MlcVmPanicCallback panic_callback = nullptr;
-  std::unordered_map<std::string, std::vector<std::uint8_t>> modules;
+  std::unordered_map<std::string, std::shared_ptr<const ThreadedModule>> modules;
   std::vector<HandleSlot> handles;
+  MlcVmHeapStats heap_stats{};
 };
 
 void maybe_panic(EmbeddingVmState* vm, const char* message) {
@@ -32,6 +43,22 @@ void maybe_panic(EmbeddingVmState* vm, const char* message) {
   }
 }
 
+// embedding.mlc run_err_to_code.
+std::int32_t run_error_to_code(ThreadedRunError error) {
+  switch (error) {
+    case ThreadedRunError::none:
+      return embedding::emb_ok();
+    case ThreadedRunError::verify:
+      return embedding::emb_verify();
+    case ThreadedRunError::bounds:
+      return embedding::emb_bounds();
+    case ThreadedRunError::stack:
+      return embedding::emb_stack();
+    default:
+      return embedding::emb_type();
+  }
+}
+
 } // namespace
 
 struct MlcVm {
@@ -79,7 +106,12 @@ MlcResult mlc_vm_load_module(
     return result;
   }
   const auto* bytes = static_cast<const std::uint8_t*>(source_or_bytecode);
-  vm->state.modules[std::string(name)] = std::vector<std::uint8_t>(bytes, bytes + size);
+  auto module = mlc::script_vm::threaded_module_decode(bytes, size);
+  if (module == nullptr) {
+    result.code = embedding::emb_verify();
+    return result;
+  }
+  vm->state.modules[std::string(name)] = std::move(module);
   result.code = embedding::emb_ok();
   return result;
 }
@@ -96,7 +128,8 @@ MlcHandle mlc_vm_get_export(MlcVm* vm, const char* module_name, const char* expo
   slot.live = true;
   slot.module_name = module_name;
   slot.export_name = export_name;
-  slot.blob = module_it->second;
+  slot.module = module_it->second;
+  slot.proto_index = mlc::script_vm::threaded_module_find_export(*slot.module, slot.export_name);
   vm->state.handles.push_back(std::move(slot));
   return static_cast<MlcHandle>(vm->state.handles.size());
 }
@@ -126,21 +159,34 @@ MlcResult mlc_vm_call(
     result.code = embedding::emb_bounds();
     return result;
   }
-  std::int64_t result_raw = 0;
-  const auto data_pointer = reinterpret_cast<std::int64_t>(slot.blob.data());
-  const auto args_pointer = reinterpret_cast<std::int64_t>(args);
-  const auto result_pointer = reinterpret_cast<std::int64_t>(&result_raw);
-  const auto code = embedding::emb_call_export_ptr(
-      data_pointer,
-      static_cast<std::int32_t>(slot.blob.size()),
-      mlc::String(slot.export_name.c_str()),
-      args_pointer,
-      static_cast<std::int32_t>(argc),
-      result_pointer
-  );
-  result.code = code;
-  if (code == embedding::emb_ok()) {
-    result_value->raw = result_raw;
+  if (slot.proto_index < 0) {
+    result.code = embedding::emb_not_found();
+    return result;
+  }
+  static_assert(sizeof(MlcValue) == sizeof(std::int64_t), "MlcValue must be a bare i64");
+  // A null args pointer reads as zero raws, like embedding_i64_at.
+  std::vector<std::int64_t> zero_args;
+  const std::int64_t* arg_raws = reinterpret_cast<const std::int64_t*>(args);
+  if (args == nullptr) {
+    zero_args.assign(argc, 0);
+    arg_raws = zero_args.data();
+  }
+  const auto started = std::chrono::steady_clock::now();
+  const auto called = mlc::script_vm::threaded_call(*slot.module, slot.proto_index, arg_raws, argc);
+  const auto call_time = std::chrono::duration_cast<std::chrono::microseconds>(
+      std::chrono::steady_clock::now() - started);
+  MlcVmHeapStats& stats = vm->state.heap_stats;
+  stats.calls += 1;
+  stats.call_time_us += static_cast<std::uint64_t>(call_time.count());
+  stats.allocated_objects += called.heap_stats.allocated_objects;
+  stats.allocated_bytes += called.heap_stats.allocated_bytes;
+  stats.minor_collections += called.heap_stats.minor_collections;
+  stats.gc_pause_total_us += called.heap_stats.gc_pause_total_us;
+  stats.gc_pause_max_us = std::max(stats.gc_pause_max_us, called.heap_stats.gc_pause_max_us);
+  stats.write_barrier_hits += called.heap_stats.write_barrier_hits;
+  result.code = run_error_to_code(called.error);
+  if (called.error == ThreadedRunError::none) {
+    result_value->raw = called.raw;
   }
   return result;
 }
@@ -157,7 +203,18 @@ void mlc_handle_release(MlcVm* vm, MlcHandle handle) {
     return;
   }
   slot.live = false;
-  slot.blob.clear();
+  slot.module.reset();
+}
+
+MlcResult mlc_vm_heap_stats(MlcVm* vm, MlcVmHeapStats* out) {
+  MlcResult result{};
+  if (vm == nullptr || out == nullptr) {
+    result.code = embedding::emb_type();
+    return result;
+  }
+  *out = vm->state.heap_stats;
+  result.code = embedding::emb_ok();
+  return result;
 }
 
 size_t mlc_script_vm_fixture_add1(uint8_t* out, size_t capacity) {
@@ -0,0 +1,891 @@
+// TRACK_MLC_SCRIPT_VM §103i — native threaded-code backend (execute_program twin).
+#include "mlc/script_vm/threaded_dispatch.hpp"
+
+#include "mlc/script_vm/value_rep_abi.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#if defined(__GNUC__) || defined(__clang__)
+#define MLC_SCRIPT_VM_COMPUTED_GOTO 1
+#else
+#define MLC_SCRIPT_VM_COMPUTED_GOTO 0
+#endif
+
+namespace mlc {
+namespace script_vm {
+
+namespace {
+
+// bytecode.mlc opcode tags (frozen §103b).
+constexpr std::int32_t k_opcode_load_const = 1;
+constexpr std::int32_t k_opcode_move = 2;
+constexpr std::int32_t k_opcode_add = 3;
+constexpr std::int32_t k_opcode_sub = 4;
+constexpr std::int32_t k_opcode_return = 7;
+constexpr std::int32_t k_opcode_jump = 8;
+constexpr std::int32_t k_opcode_jump_if_false = 9;
+constexpr std::int32_t k_opcode_le = 13;
+constexpr std::int32_t k_opcode_call = 22;
+constexpr std::int32_t k_opcode_make_closure = 23;
+constexpr std::int32_t k_opcode_get_upval = 24;
+constexpr std::int32_t k_opcode_set_upval = 25;
+constexpr std::int32_t k_opcode_last = 25;
+
+// heap.mlc type ids.
+constexpr std::int32_t k_heap_type_cell = 1;
+constexpr std::int32_t k_heap_type_closure = 4;
+
+constexpr std::int32_t k_magic_mlsc = 1129531469;
+constexpr std::int32_t k_max_frames = 256;
+
+struct WordFields {
+  std::int32_t opcode;
+  std::int32_t a;
+  std::int32_t b;
+  std::int32_t c;
+};
+
+WordFields decode_word(std::int32_t word) {
+  return WordFields{word & 255, (word >> 8) & 255, (word >> 16) & 255, (word >> 24) & 255};
+}
+
+bool word_is_wide(const WordFields& fields) {
+  return (fields.opcode == k_opcode_load_const || fields.opcode == k_opcode_jump ||
+          fields.opcode == k_opcode_jump_if_false) &&
+         fields.b == 0 && fields.c == 1;
+}
+
+std::int32_t unpack_i16(std::int32_t b, std::int32_t c) {
+  const std::int32_t rebuilt = ((b & 255) << 8) | (c & 255);
+  return (rebuilt & 32768) != 0 ? rebuilt - 65536 : rebuilt;
+}
+
+class BlobReader {
+ public:
+  BlobReader(const std::uint8_t* bytes, std::size_t size) : bytes_(bytes), size_(size) {}
+
+  bool has(std::int64_t count) const {
+    return count >= 0 && offset_ + static_cast<std::size_t>(count) <= size_;
+  }
+
+  std::int32_t u32() {
+    const std::uint32_t value = static_cast<std::uint32_t>(bytes_[offset_]) |
+                                (static_cast<std::uint32_t>(bytes_[offset_ + 1]) << 8) |
+                                (static_cast<std::uint32_t>(bytes_[offset_ + 2]) << 16) |
+                                (static_cast<std::uint32_t>(bytes_[offset_ + 3]) << 24);
+    offset_ += 4;
+    return static_cast<std::int32_t>(value);
+  }
+
+  std::int64_t i64() {
+    std::uint64_t value = 0;
+    for (std::size_t index = 0; index < 8; ++index) {
+      value |= static_cast<std::uint64_t>(bytes_[offset_ + index]) << (index * 8);
+    }
+    offset_ += 8;
+    return static_cast<std::int64_t>(value);
+  }
+
+  std::string text(std::int32_t length) {
+    std::string value(reinterpret_cast<const char*>(bytes_ + offset_),
+                      static_cast<std::size_t>(length));
+    offset_ += static_cast<std::size_t>(length);
+    return value;
+  }
+
+  bool at_end() const { return offset_ == size_; }
+
+ private:
+  const std::uint8_t* bytes_;
+  std::size_t size_;
+  std::size_t offset_ = 0;
+};
+
+// Lowers one verified word stream into threaded code. Returns false on input
+// the verifier would have rejected.
+bool lower_proto(
+    const std::vector<std::int32_t>& words,
+    std::int32_t proto_count,
+    ThreadedProto& proto
+) {
+  const auto word_count = static_cast<std::int32_t>(words.size());
+  std::vector<std::int32_t> insn_at_word(words.size() + 1, -1);
+  std::vector<std::int32_t> jump_word_targets;
+
+  std::int32_t word_index = 0;
+  while (word_index < word_count) {
+    const WordFields fields = decode_word(words[static_cast<std::size_t>(word_index)]);
+    if (fields.opcode < 1 || fields.opcode > k_opcode_last) {
+      return false;
+    }
+    std::int32_t span = 1;
+    if (fields.opcode == k_opcode_make_closure) {
+      span = 1 + fields.c;
+    } else if (word_is_wide(fields)) {
+      span = 2;
+    }
+    if (word_index + span > word_count) {
+      return false;
+    }
+    const std::int32_t wide_operand =
+        span == 2 ? words[static_cast<std::size_t>(word_index + 1)] : 0;
+
+    ThreadedInsn insn;
+    insn.a = static_cast<std::uint8_t>(fields.a);
+    insn.b = static_cast<std::uint8_t>(fields.b);
+    insn.c = static_cast<std::uint8_t>(fields.c);
+    insn.word_index = word_index;
+    std::int32_t jump_word_target = -1;
+
+    switch (fields.opcode) {
+      case k_opcode_load_const:
+        insn.op = ThreadedOp::load_const;
+        insn.operand = span == 2 ? wide_operand : fields.b;
+        if (insn.operand < 0 ||
+            insn.operand >= static_cast<std::int32_t>(proto.constants.size())) {
+          return false;
+        }
+        break;
+      case k_opcode_move:
+        insn.op = ThreadedOp::move;
+        break;
+      case k_opcode_add:
+        insn.op = ThreadedOp::add;
+        break;
+      case k_opcode_sub:
+        insn.op = ThreadedOp::sub;
+        break;
+      case k_opcode_return:
+        insn.op = ThreadedOp::ret;
+        break;
+      case k_opcode_jump:
+      case k_opcode_jump_if_false: {
+        insn.op = fields.opcode == k_opcode_jump ? ThreadedOp::jump : ThreadedOp::jump_if_false;
+        const std::int32_t offset = span == 2 ? wide_operand : unpack_i16(fields.b, fields.c);
+        jump_word_target = word_index + span + offset;
+        if (jump_word_target < 0 || jump_word_target > word_count) {
+          return false;
+        }
+        break;
+      }
+      case k_opcode_le:
+        insn.op = ThreadedOp::le;
+        break;
+      case k_opcode_call:
+        insn.op = ThreadedOp::call;
+        break;
+      case k_opcode_make_closure:
+        // An out-of-range proto always raises run_err_type when executed.
+        insn.op = fields.b < proto_count ? ThreadedOp::make_closure : ThreadedOp::type_error;
+        insn.operand = static_cast<std::int32_t>(proto.upvalue_sources.size());
+        for (std::int32_t up_index = 0; up_index < fields.c; ++up_index) {
+          const std::int32_t source_word = words[static_cast<std::size_t>(word_index + 1 + up_index)];
+          proto.upvalue_sources.push_back(
+              ThreadedUpvalueSource{(source_word >> 8) & 255, source_word & 255});
+        }
+        break;
+      case k_opcode_get_upval:
+        insn.op = ThreadedOp::get_upval;
+        break;
+      case k_opcode_set_upval:
+        insn.op = ThreadedOp::set_upval;
+        break;
+      default:
+        // Verified but outside the execute_program subset (arrays, records, mul, ...).
+        insn.op = ThreadedOp::unsupported;
+        break;
+    }
+
+    insn_at_word[static_cast<std::size_t>(word_index)] =
+        static_cast<std::int32_t>(proto.code.size());
+    jump_word_targets.push_back(jump_word_target);
+    proto.code.push_back(insn);
+    word_index += span;
+  }
+
+  ThreadedInsn sentinel;
+  sentinel.op = ThreadedOp::fall_off;
+  sentinel.word_index = word_count;
+  insn_at_word[static_cast<std::size_t>(word_count)] = static_cast<std::int32_t>(proto.code.size());
+  proto.code.push_back(sentinel);
+
+  for (std::size_t index = 0; index < jump_word_targets.size(); ++index) {
+    const std::int32_t target = jump_word_targets[index];
+    if (target < 0) {
+      continue;
+    }
+    const std::int32_t insn_index = insn_at_word[static_cast<std::size_t>(target)];
+    if (insn_index < 0) {
+      return false;
+    }
+    proto.code[index].operand = insn_index;
+  }
+  proto.word_count = word_count;
+  return true;
+}
+
+struct NativeObject {
+  std::int32_t type_id = 0;
+  std::int32_t gc_flags = 0;
+  std::int32_t proto_index = 0;
+  std::int32_t size_class = 0;
+  std::int32_t element_count = 0;
+  std::int32_t free_next = -1;
+  bool live = false;
+  std::int64_t child = 0;
+  // Sized to the size-class capacity; element_count are in use.
+  std::vector<std::int64_t> elements;
+};
+
+struct NativeFrame {
+  std::int32_t proto_index;
+  std::int32_t resume_insn;
+  std::size_t register_base;
+  std::int64_t closure;
+  std::int32_t return_dst;
+};
+
+// heap.mlc gc_flags bits and nursery limit.
+constexpr std::int32_t k_gc_mark = 1;
+constexpr std::int32_t k_gc_old = 2;
+constexpr std::int32_t k_gc_remembered = 4;
+constexpr std::size_t k_nursery_limit = 4096;
+
+std::int32_t size_class_for(std::int32_t element_count) {
+  if (element_count <= 0) {
+    return 0;
+  }
+  if (element_count <= 4) {
+    return 1;
+  }
+  return element_count <= 12 ? 2 : 3;
+}
+
+std::int32_t size_class_capacity(std::int32_t size_class, std::int32_t element_count) {
+  static constexpr std::int32_t k_capacity[] = {0, 4, 12, 28};
+  return size_class < 3 ? k_capacity[size_class] : std::max(element_count, k_capacity[3]);
+}
+
+std::int32_t size_class_alloc_bytes(std::int32_t size_class, std::int32_t element_count) {
+  static constexpr std::int32_t k_bytes[] = {32, 64, 128, 256};
+  return size_class < 3 || element_count <= 28 ? k_bytes[size_class] : 32 + element_count * 8;
+}
+
+std::uint64_t elapsed_us(std::chrono::steady_clock::time_point started) {
+  return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+                                        std::chrono::steady_clock::now() - started)
+                                        .count());
+}
+
+// Twin of script_vm/heap.mlc for the call-scoped heap: same size classes, LIFO
+// free lists, nursery, remembered set and sweep order, so object ids match.
+class NativeHeap {
+ public:
+  explicit NativeHeap(ThreadedHeapStats& stats) : stats_(stats) {}
+
+  std::int32_t live_id(std::int64_t raw) const {
+    if (decode_kind(raw) != 4) {
+      return -1;
+    }
+    const std::int32_t object_id = decode_heap_object_id(raw);
+    if (object_id < 0 || object_id >= static_cast<std::int32_t>(objects_.size()) ||
+        !objects_[static_cast<std::size_t>(object_id)].live) {
+      return -1;
+    }
+    return object_id;
+  }
+
+  std::int32_t type_of(std::int64_t raw) const {
+    const std::int32_t object_id = live_id(raw);
+    return object_id < 0 ? 0 : objects_[static_cast<std::size_t>(object_id)].type_id;
+  }
+
+  NativeObject& object(std::int64_t raw) {
+    return objects_[static_cast<std::size_t>(decode_heap_object_id(raw))];
+  }
+
+  std::size_t young_count() const { return young_.size(); }
+
+  std::int64_t alloc(std::int32_t type_id, std::int32_t object_flags, std::int32_t element_count) {
+    const std::int32_t size_class = size_class_for(element_count);
+    std::int32_t object_id = free_heads_[size_class];
+    if (object_id >= 0 &&
+        static_cast<std::int32_t>(objects_[static_cast<std::size_t>(object_id)].elements.size()) >=
+            element_count) {
+      free_heads_[size_class] = objects_[static_cast<std::size_t>(object_id)].free_next;
+    } else {
+      object_id = static_cast<std::int32_t>(objects_.size());
+      objects_.emplace_back();
+      objects_.back().elements.assign(
+          static_cast<std::size_t>(size_class_capacity(size_class, element_count)), encode_nil());
+    }
+    NativeObject& created = objects_[static_cast<std::size_t>(object_id)];
+    created.type_id = type_id;
+    created.gc_flags = 0;
+    created.proto_index = object_flags;
+    created.size_class = size_class;
+    created.element_count = element_count;
+    created.free_next = -1;
+    created.live = true;
+    created.child = encode_nil();
+    std::fill_n(created.elements.begin(), element_count, encode_nil());
+    young_.push_back(object_id);
+    stats_.allocated_objects += 1;
+    stats_.allocated_bytes += static_cast<std::uint64_t>(size_class_alloc_bytes(size_class, element_count));
+    return encode_heap(object_id);
+  }
+
+  void write_barrier(std::int64_t parent, std::int32_t slot_index, std::int64_t new_child) {
+    const std::int32_t object_id = live_id(parent);
+    if (object_id >= 0) {
+      NativeObject& target = objects_[static_cast<std::size_t>(object_id)];
+      if (target.type_id == k_heap_type_cell) {
+        target.child = new_child;
+        remember_if_old_to_young(object_id, new_child);
+      } else if (slot_index >= 0 && slot_index < target.element_count) {
+        target.elements[static_cast<std::size_t>(slot_index)] = new_child;
+        remember_if_old_to_young(object_id, new_child);
+      }
+    }
+    stats_.write_barrier_hits += 1;
+  }
+
+  void collect_young(const std::vector<std::int64_t>& roots) {
+    const auto started = std::chrono::steady_clock::now();
+    for (const auto root : roots) {
+      mark_gray(root);
+    }
+    drain();
+    for (const auto old_id : remembered_) {
+      NativeObject& old_object = objects_[static_cast<std::size_t>(old_id)];
+      if (old_object.live) {
+        old_object.gc_flags &= ~k_gc_remembered;
+        mark_children(old_id);
+        drain();
+      }
+    }
+    for (const auto object_id : young_) {
+      NativeObject& young_object = objects_[static_cast<std::size_t>(object_id)];
+      if (!young_object.live) {
+        continue;
+      }
+      if ((young_object.gc_flags & k_gc_mark) != 0) {
+        young_object.gc_flags = k_gc_old;
+      } else {
+        young_object.type_id = 0;
+        young_object.gc_flags = 0;
+        young_object.live = false;
+        young_object.element_count = 0;
+        young_object.free_next = free_heads_[young_object.size_class];
+        free_heads_[young_object.size_class] = object_id;
+      }
+    }
+    young_.clear();
+    remembered_.clear();
+    const std::uint64_t pause = elapsed_us(started);
+    stats_.minor_collections += 1;
+    stats_.gc_pause_total_us += pause;
+    stats_.gc_pause_max_us = std::max(stats_.gc_pause_max_us, pause);
+  }
+
+ private:
+  void remember_if_old_to_young(std::int32_t parent_id, std::int64_t new_child) {
+    NativeObject& parent = objects_[static_cast<std::size_t>(parent_id)];
+    const std::int32_t child_id = live_id(new_child);
+    if (child_id < 0 || (parent.gc_flags & k_gc_old) == 0 ||
+        (parent.gc_flags & k_gc_remembered) != 0 ||
+        (objects_[static_cast<std::size_t>(child_id)].gc_flags & k_gc_old) != 0) {
+      return;
+    }
+    parent.gc_flags |= k_gc_remembered;
+    remembered_.push_back(parent_id);
+  }
+
+  void mark_gray(std::int64_t raw) {
+    const std::int32_t object_id = live_id(raw);
+    if (object_id < 0) {
+      return;
+    }
+    NativeObject& target = objects_[static_cast<std::size_t>(object_id)];
+    if ((target.gc_flags & (k_gc_mark | k_gc_old)) != 0) {
+      return;
+    }
+    target.gc_flags |= k_gc_mark;
+    mark_stack_.push_back(object_id);
+  }
+
+  void mark_children(std::int32_t object_id) {
+    mark_gray(objects_[static_cast<std::size_t>(object_id)].child);
+    const std::int32_t count = objects_[static_cast<std::size_t>(object_id)].element_count;
+    for (std::int32_t index = 0; index < count; ++index) {
+      mark_gray(objects_[static_cast<std::size_t>(object_id)].elements[static_cast<std::size_t>(index)]);
+    }
+  }
+
+  void drain() {
+    while (!mark_stack_.empty()) {
+      const std::int32_t object_id = mark_stack_.back();
+      mark_stack_.pop_back();
+      mark_children(object_id);
+    }
+  }
+
+  ThreadedHeapStats& stats_;
+  std::vector<NativeObject> objects_;
+  std::int32_t free_heads_[4] = {-1, -1, -1, -1};
+  std::vector<std::int32_t> young_;
+  std::vector<std::int32_t> remembered_;
+  std::vector<std::int32_t> mark_stack_;
+};
+
+void register_window_open(
+    std::vector<std::int64_t>& register_file,
+    std::size_t register_base,
+    std::int32_t register_count
+) {
+  const std::size_t end = register_base + static_cast<std::size_t>(register_count);
+  if (register_file.size() < end) {
+    register_file.resize(end, encode_nil());
+  }
+  for (std::size_t index = register_base; index < end; ++index) {
+    register_file[index] = encode_nil();
+  }
+}
+
+bool value_is_falsy(std::int64_t raw) {
+  switch (decode_kind(raw)) {
+    case 1:
+      return true;
+    case 2:
+      return decode_bool(raw) == 0;
+    case 3:
+      return decode_int32(raw) == 0;
+    case 4:
+      return false;
+    default:
+      return decode_float64(raw) == 0.0;
+  }
+}
+
+}  // namespace
+
+std::shared_ptr<const ThreadedModule> threaded_module_decode(
+    const std::uint8_t* bytes, std::size_t size) {
+  if (bytes == nullptr || size < 8) {
+    return nullptr;
+  }
+  BlobReader reader(bytes, size);
+  if (reader.u32() != k_magic_mlsc || reader.u32() != 1 || !reader.has(4)) {
+    return nullptr;
+  }
+  auto module = std::make_shared<ThreadedModule>();
+  const std::int32_t export_count = reader.u32();
+  for (std::int32_t export_index = 0; export_index < export_count; ++export_index) {
+    if (!reader.has(4)) {
+      return nullptr;
+    }
+    const std::int32_t name_length = reader.u32();
+    if (name_length < 0 || !reader.has(static_cast<std::int64_t>(name_length) + 4)) {
+      return nullptr;
+    }
+    ThreadedExport entry;
+    entry.name = reader.text(name_length);
+    entry.proto_index = reader.u32();
+    module->exports.push_back(std::move(entry));
+  }
+  if (!reader.has(4)) {
+    return nullptr;
+  }
+  const std::int32_t proto_count = reader.u32();
+  std::vector<std::vector<std::int32_t>> proto_words;
+  for (std::int32_t proto_index = 0; proto_index < proto_count; ++proto_index) {
+    if (!reader.has(8)) {
+      return nullptr;
+    }
+    ThreadedProto proto;
+    proto.register_count = reader.u32();
+    const std::int32_t word_count = reader.u32();
+    if (word_count < 0 || !reader.has(static_cast<std::int64_t>(word_count) * 4 + 4)) {
+      return nullptr;
+    }
+    std::vector<std::int32_t> words(static_cast<std::size_t>(word_count));
+    for (auto& word : words) {
+      word = reader.u32();
+    }
+    const std::int32_t constant_count = reader.u32();
+    if (constant_count < 0 || !reader.has(static_cast<std::int64_t>(constant_count) * 8)) {
+      return nullptr;
+    }
+    proto.constants.resize(static_cast<std::size_t>(constant_count));
+    for (auto& constant : proto.constants) {
+      constant = reader.i64();
+    }
+    module->protos.push_back(std::move(proto));
+    proto_words.push_back(std::move(words));
+  }
+  if (!reader.at_end()) {
+    return nullptr;
+  }
+  for (std::size_t proto_index = 0; proto_index < module->protos.size(); ++proto_index) {
+    if (!lower_proto(proto_words[proto_index], proto_count, module->protos[proto_index])) {
+      return nullptr;
+    }
+  }
+  return module;
+}
+
+std::int32_t threaded_module_find_export(
+    const ThreadedModule& module, const std::string& export_name) {
+  for (const auto& entry : module.exports) {
+    if (entry.name == export_name) {
+      return entry.proto_index;
+    }
+  }
+  return -1;
+}
+
+ThreadedCallResult threaded_call(
+    const ThreadedModule& module,
+    std::int32_t entry_proto_index,
+    const std::int64_t* args,
+    std::size_t argc) {
+  ThreadedCallResult result;
+  if (entry_proto_index < 0 ||
+      entry_proto_index >= static_cast<std::int32_t>(module.protos.size())) {
+    result.error = ThreadedRunError::type;
+    return result;
+  }
+
+  const std::vector<ThreadedProto>& protos = module.protos;
+  std::vector<std::int64_t> register_file;
+  std::vector<NativeFrame> frames;
+  NativeHeap heap(result.heap_stats);
+  std::vector<std::int64_t> safepoint_roots;
+  std::int32_t frame_depth = 1;
+
+  // Running frame lives in locals; spilled to `frames` only on CALL.
+  std::int32_t proto_index = entry_proto_index;
+  const ThreadedProto* proto = &protos[static_cast<std::size_t>(proto_index)];
+  const ThreadedInsn* insn = proto->code.data();
+  std::size_t base = 0;
+  std::int64_t closure = encode_nil();
+  std::int32_t return_dst = 0;
+
+  register_window_open(register_file, base, proto->register_count);
+  for (std::size_t arg_index = 0;
+       arg_index < argc && arg_index < static_cast<std::size_t>(proto->register_count);
+       ++arg_index) {
+    register_file[arg_index] = args[arg_index];
+  }
+  std::int64_t* regs = register_file.data() + base;
+
+#if MLC_SCRIPT_VM_COMPUTED_GOTO
+  static const void* const k_handlers[] = {
+      &&op_load_const,
+      &&op_move,
+      &&op_add,
+      &&op_sub,
+      &&op_ret,
+      &&op_jump,
+      &&op_jump_if_false,
+      &&op_le,
+      &&op_call,
+      &&op_make_closure,
+      &&op_get_upval,
+      &&op_set_upval,
+      &&op_type_error,
+      &&op_unsupported,
+      &&op_fall_off,
+  };
+  static_assert(sizeof(k_handlers) / sizeof(k_handlers[0]) ==
+                    static_cast<std::size_t>(ThreadedOp::count),
+                "handler table out of sync with ThreadedOp");
+#define MLC_DISPATCH() goto* k_handlers[static_cast<std::size_t>(insn->op)]
+#define MLC_HANDLER(name) op_##name
+#else
+#define MLC_DISPATCH() goto dispatch
+#define MLC_HANDLER(name) case ThreadedOp::name
+#endif
+#define MLC_FAIL(kind)            \
+  do {                            \
+    result.error = (kind);        \
+    result.error_at = insn->word_index; \
+    goto done;                    \
+  } while (0)
+
+  MLC_DISPATCH();
+
+#if !MLC_SCRIPT_VM_COMPUTED_GOTO
+dispatch:
+  switch (insn->op) {
+#endif
+
+  MLC_HANDLER(load_const) : {
+    regs[insn->a] = proto->constants[static_cast<std::size_t>(insn->operand)];
+    ++insn;
+    MLC_DISPATCH();
+  }
+
+  MLC_HANDLER(move) : {
+    regs[insn->a] = regs[insn->b];
+    ++insn;
+    MLC_DISPATCH();
+  }
+
+  MLC_HANDLER(add) : {
+    const std::int64_t left = regs[insn->b];
+    const std::int64_t right = regs[insn->c];
+    const std::int32_t left_kind = decode_kind(left);
+    if (left_kind == 3) {
+      if (decode_kind(right) != 3) {
+        MLC_FAIL(ThreadedRunError::type);
+      }
+      const std::int64_t sum =
+          static_cast<std::int64_t>(decode_int32(left)) + decode_int32(right);
+      if (sum < INT32_MIN || sum > INT32_MAX) {
+        MLC_FAIL(ThreadedRunError::overflow);
+      }
+      regs[insn->a] = encode_int32(static_cast<std::int32_t>(sum));
+    } else if (left_kind == 0) {
+      if (decode_kind(right) != 0) {
+        MLC_FAIL(ThreadedRunError::type);
+      }
+      regs[insn->a] = encode_float64(decode_float64(left) + decode_float64(right));
+    } else {
+      MLC_FAIL(ThreadedRunError::type);
+    }
+    ++insn;
+    MLC_DISPATCH();
+  }
+
+  MLC_HANDLER(sub) : {
+    const std::int64_t left = regs[insn->b];
+    const std::int64_t right = regs[insn->c];
+    const std::int32_t left_kind = decode_kind(left);
+    if (left_kind == 3) {
+      if (decode_kind(right) != 3) {
+        MLC_FAIL(ThreadedRunError::type);
+      }
+      const std::int64_t difference =
+          static_cast<std::int64_t>(decode_int32(left)) - decode_int32(right);
+      if (difference < INT32_MIN || difference > INT32_MAX) {
+        MLC_FAIL(ThreadedRunError::overflow);
+      }
+      regs[insn->a] = encode_int32(static_cast<std::int32_t>(difference));
+    } else if (left_kind == 0) {
+      if (decode_kind(right) != 0) {
+        MLC_FAIL(ThreadedRunError::type);
+      }
+      regs[insn->a] = encode_float64(decode_float64(left) - decode_float64(right));
+    } else {
+      MLC_FAIL(ThreadedRunError::type);
+    }
+    ++insn;
+    MLC_DISPATCH();
+  }
+
+  MLC_HANDLER(ret) : {
+    const std::int64_t value = regs[insn->a];
+    if (frame_depth == 1) {
+      result.raw = value;
+      goto done;
+    }
+    frame_depth -= 1;
+    const NativeFrame& caller = frames[static_cast<std::size_t>(frame_depth - 1)];
+    proto_index = caller.proto_index;
+    proto = &protos[static_cast<std::size_t>(proto_index)];
+    insn = proto->code.data() + caller.resume_insn;
+    base = caller.register_base;
+    closure = caller.closure;
+    regs = register_file.data() + base;
+    regs[return_dst] = value;
+    return_dst = caller.return_dst;
+    MLC_DISPATCH();
+  }
+
+  MLC_HANDLER(jump) : {
+    insn = proto->code.data() + insn->operand;
+    MLC_DISPATCH();
+  }
+
+  MLC_HANDLER(jump_if_false) : {
+    if (value_is_falsy(regs[insn->a])) {
+      insn = proto->code.data() + insn->operand;
+    } else {
+      ++insn;
+    }
+    MLC_DISPATCH();
+  }
+
+  MLC_HANDLER(le) : {
+    const std::int64_t left = regs[insn->b];
+    const std::int64_t right = regs[insn->c];
+    const std::int32_t left_kind = decode_kind(left);
+    if (left_kind == 3) {
+      if (decode_kind(right) != 3) {
+        MLC_FAIL(ThreadedRunError::type);
+      }
+      regs[insn->a] = encode_bool(decode_int32(left) <= decode_int32(right) ? 1 : 0);
+    } else if (left_kind == 0) {
+      if (decode_kind(right) != 0) {
+        MLC_FAIL(ThreadedRunError::type);
+      }
+      regs[insn->a] = encode_bool(decode_float64(left) <= decode_float64(right) ? 1 : 0);
+    } else {
+      MLC_FAIL(ThreadedRunError::type);
+    }
+    ++insn;
+    MLC_DISPATCH();
+  }
+
+  MLC_HANDLER(call) : {
+    const std::int64_t callee_value = regs[insn->b];
+    if (frame_depth >= k_max_frames) {
+      MLC_FAIL(ThreadedRunError::stack);
+    }
+    if (heap.type_of(callee_value) != k_heap_type_closure) {
+      MLC_FAIL(ThreadedRunError::type);
+    }
+    const std::int32_t callee_proto_index = heap.object(callee_value).proto_index;
+    if (callee_proto_index < 0 || callee_proto_index >= static_cast<std::int32_t>(protos.size())) {
+      MLC_FAIL(ThreadedRunError::type);
+    }
+    const NativeFrame spilled{
+        proto_index,
+        static_cast<std::int32_t>(insn - proto->code.data()) + 1,
+        base,
+        closure,
+        return_dst,
+    };
+    if (static_cast<std::size_t>(frame_depth - 1) < frames.size()) {
+      frames[static_cast<std::size_t>(frame_depth - 1)] = spilled;
+    } else {
+      frames.push_back(spilled);
+    }
+    const ThreadedProto* callee = &protos[static_cast<std::size_t>(callee_proto_index)];
+    const std::size_t callee_base = base + static_cast<std::size_t>(proto->register_count);
+    register_window_open(register_file, callee_base, callee->register_count);
+    for (std::int32_t arg_index = 0; arg_index < insn->c; ++arg_index) {
+      const std::int32_t source = insn->b + 1 + arg_index;
+      if (source < proto->register_count && arg_index < callee->register_count) {
+        register_file[callee_base + static_cast<std::size_t>(arg_index)] =
+            register_file[base + static_cast<std::size_t>(source)];
+      }
+    }
+    return_dst = insn->a;
+    frame_depth += 1;
+    proto_index = callee_proto_index;
+    proto = callee;
+    insn = proto->code.data();
+    base = callee_base;
+    closure = callee_value;
+    regs = register_file.data() + base;
+    MLC_DISPATCH();
+  }
+
+  MLC_HANDLER(make_closure) : {
+    // Allocation safepoint (interpreter.mlc collect_young_at_safepoint).
+    if (heap.young_count() >= k_nursery_limit) {
+      safepoint_roots.assign(
+          register_file.begin(),
+          register_file.begin() + static_cast<std::ptrdiff_t>(
+                                      base + static_cast<std::size_t>(proto->register_count)));
+      for (std::int32_t frame_index = 0; frame_index < frame_depth - 1; ++frame_index) {
+        safepoint_roots.push_back(frames[static_cast<std::size_t>(frame_index)].closure);
+      }
+      safepoint_roots.push_back(closure);
+      heap.collect_young(safepoint_roots);
+    }
+    const std::int64_t closure_value = heap.alloc(k_heap_type_closure, insn->b, insn->c);
+    for (std::int32_t up_index = 0; up_index < insn->c; ++up_index) {
+      const ThreadedUpvalueSource& source =
+          proto->upvalue_sources[static_cast<std::size_t>(insn->operand + up_index)];
+      if (source.is_local != 0) {
+        const std::size_t register_index = base + static_cast<std::size_t>(source.index);
+        const std::int64_t cell_value = heap.alloc(k_heap_type_cell, 0, 0);
+        heap.write_barrier(cell_value, 0,
+                           register_index < register_file.size() ? register_file[register_index]
+                                                                 : encode_nil());
+        heap.write_barrier(closure_value, up_index, cell_value);
+      } else if (heap.type_of(closure) != k_heap_type_closure) {
+        MLC_FAIL(ThreadedRunError::type);
+      } else {
+        const NativeObject& parent = heap.object(closure);
+        const std::int64_t parent_cell =
+            source.index < parent.element_count
+                ? parent.elements[static_cast<std::size_t>(source.index)]
+                : encode_nil();
+        heap.write_barrier(closure_value, up_index, parent_cell);
+      }
+    }
+    regs[insn->a] = closure_value;
+    ++insn;
+    MLC_DISPATCH();
+  }
+
+  MLC_HANDLER(get_upval) : {
+    if (heap.type_of(closure) != k_heap_type_closure) {
+      MLC_FAIL(ThreadedRunError::type);
+    }
+    const NativeObject& owner = heap.object(closure);
+    if (insn->b >= owner.element_count) {
+      MLC_FAIL(ThreadedRunError::bounds);
+    }
+    const std::int64_t cell = owner.elements[insn->b];
+    if (heap.type_of(cell) != k_heap_type_cell) {
+      MLC_FAIL(ThreadedRunError::type);
+    }
+    regs[insn->a] = heap.object(cell).child;
+    ++insn;
+    MLC_DISPATCH();
+  }
+
+  MLC_HANDLER(set_upval) : {
+    if (heap.type_of(closure) != k_heap_type_closure) {
+      MLC_FAIL(ThreadedRunError::type);
+    }
+    const NativeObject& owner = heap.object(closure);
+    if (insn->a >= owner.element_count) {
+      MLC_FAIL(ThreadedRunError::bounds);
+    }
+    const std::int64_t cell = owner.elements[insn->a];
+    if (heap.type_of(cell) != k_heap_type_cell) {
+      MLC_FAIL(ThreadedRunError::type);
+    }
+    heap.write_barrier(cell, 0, regs[insn->b]);
+    ++insn;
+    MLC_DISPATCH();
+  }
+
+  MLC_HANDLER(type_error) : {
+    MLC_FAIL(ThreadedRunError::type);
+  }
+
+  MLC_HANDLER(unsupported) : {
+    MLC_FAIL(ThreadedRunError::unsupported_opcode);
+  }
+
+  MLC_HANDLER(fall_off) : {
+    MLC_FAIL(ThreadedRunError::no_return);
+  }
+
+#if !MLC_SCRIPT_VM_COMPUTED_GOTO
+    case ThreadedOp::count:
+      MLC_FAIL(ThreadedRunError::unsupported_opcode);
+  }
+#endif
+
+#undef MLC_FAIL
+#undef MLC_HANDLER
+#undef MLC_DISPATCH
+
+done:
+  return result;
+}
+
+}  // namespace script_vm
+}  // namespace mlc
@@ -73,5 +73,9 @@ echo "[concurrency smoke] stress_arc"
 run_test stress_arc "${sanitize_flags[@]}"
 echo "[concurrency smoke] stress_spawn"
 run_test stress_spawn "${sanitize_flags[@]}"
+echo "[concurrency smoke] stress_cow"
+run_test stress_cow "${sanitize_flags[@]}"
+echo "[concurrency smoke] stress_fork_join"
+run_test stress_fork_join "${sanitize_flags[@]}"
 
 echo "[concurrency smoke] ok"
@@ -1,14 +1,18 @@
 // Channel stress matrix Layer 2 (TRACK_CONCURRENCY_TEST_HARNESS T2+T5).
 // Mode A: real threads. Cancel-during-send/recv via StopToken (T5).
-// g++ -std=c++20 -pthread -I../include -o stress_channel stress_channel.cpp
+// Throughput benchmark: 1–64 producers × consumers, bounded ring vs mutex queue,
+// one value per call and batched (send_many / receive_many).
+// g++ -std=c++20 -O2 -pthread -I../include -o stress_channel stress_channel.cpp
 
 #include "mlc/concurrency/channel.hpp"
 #include "mlc/concurrency/stop.hpp"
+#include "mlc/core/array.hpp"
 
 #include <atomic>
 #include <chrono>
 #include <iostream>
 #include <optional>
+#include <string>
 #include <thread>
 #include <vector>
 
@@ -352,6 +356,111 @@ void test_multi_producer_consumer_stress() {
     CHECK(receive_sum.load(std::memory_order_relaxed) == expected_sum);
 }
 
+#if defined(__SANITIZE_THREAD__) || defined(__SANITIZE_ADDRESS__)
+constexpr int benchmark_messages = 20000;
+#else
+constexpr int benchmark_messages = 1 << 20;
+#endif
+
+// `pairs` producers and `pairs` consumers move benchmark_messages ints through
+// one channel; returns messages per second, or -1 if anything was lost.
+template<typename MakeChannel>
+double measure_throughput(int pairs, MakeChannel make_channel) {
+    auto channel = make_channel();
+    const int per_producer = benchmark_messages / pairs;
+    const int total = per_producer * pairs;
+    std::atomic<int> producers_finished{0};
+    std::atomic<long long> receive_count{0};
+    std::atomic<long long> receive_sum{0};
+    std::vector<std::thread> threads;
+    threads.reserve(static_cast<size_t>(pairs) * 2);
+    const auto start = std::chrono::steady_clock::now();
+    for (int index = 0; index < pairs; ++index) {
+        threads.emplace_back([&, index] {
+            for (int step = 0; step < per_producer; ++step) channel.send(index * per_producer + step);
+            if (producers_finished.fetch_add(1, std::memory_order_acq_rel) + 1 == pairs) channel.close();
+        });
+        threads.emplace_back([&] {
+            long long count = 0;
+            long long sum = 0;
+            while (auto value = channel.receive()) {
+                ++count;
+                sum += *value;
+            }
+            receive_count.fetch_add(count, std::memory_order_relaxed);
+            receive_sum.fetch_add(sum, std::memory_order_relaxed);
+        });
+    }
+    for (auto& thread : threads) thread.join();
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    const long long expected_sum = static_cast<long long>(total) * (total - 1) / 2;
+    if (receive_count.load() != total || receive_sum.load() != expected_sum) return -1;
+    return total / seconds;
+}
+
+// Same traffic, but producers hand over batches of `batch` with send_many and
+// consumers drain up to `batch` per receive_many.
+template<typename MakeChannel>
+double measure_batched_throughput(int pairs, int batch, MakeChannel make_channel) {
+    auto channel = make_channel();
+    const int per_producer = benchmark_messages / pairs / batch * batch;
+    const int total = per_producer * pairs;
+    std::atomic<int> producers_finished{0};
+    std::atomic<long long> receive_count{0};
+    std::atomic<long long> receive_sum{0};
+    std::vector<std::thread> threads;
+    threads.reserve(static_cast<size_t>(pairs) * 2);
+    const auto start = std::chrono::steady_clock::now();
+    for (int index = 0; index < pairs; ++index) {
+        threads.emplace_back([&, index] {
+            mlc::Array<int> values;
+            for (int step = 0; step < per_producer; step += batch) {
+                values = mlc::Array<int>();
+                for (int offset = 0; offset < batch; ++offset) values.push_back(index * per_producer + step + offset);
+                channel.send_many(values);
+            }
+            if (producers_finished.fetch_add(1, std::memory_order_acq_rel) + 1 == pairs) channel.close();
+        });
+        threads.emplace_back([&] {
+            long long count = 0;
+            long long sum = 0;
+            while (true) {
+                auto values = channel.receive_many(static_cast<size_t>(batch));
+                if (values.empty()) break;
+                count += values.length();
+                for (int value : values) sum += value;
+            }
+            receive_count.fetch_add(count, std::memory_order_relaxed);
+            receive_sum.fetch_add(sum, std::memory_order_relaxed);
+        });
+    }
+    for (auto& thread : threads) thread.join();
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    const long long expected_sum = static_cast<long long>(total) * (total - 1) / 2;
+    if (receive_count.load() != total || receive_sum.load() != expected_sum) return -1;
+    return total / seconds;
+}
+
+void bench_throughput() {
+    std::cout << "  channel throughput (" << benchmark_messages << " ints, Mmsg/s)\n"
+              << "  pairs  ring(cap 1024)  mutex deque (unbounded)  ring batch 128  deque batch 128\n";
+    for (int pairs : {1, 2, 4, 8, 16, 32, 64}) {
+        const double ring = measure_throughput(pairs, [] { return mlc::concurrency::make_channel<int>(1024); });
+        const double locked = measure_throughput(pairs, [] { return mlc::concurrency::make_unbounded_channel<int>(); });
+        const double ring_batched = measure_batched_throughput(
+            pairs, 128, [] { return mlc::concurrency::make_channel<int>(1024); });
+        const double locked_batched = measure_batched_throughput(
+            pairs, 128, [] { return mlc::concurrency::make_unbounded_channel<int>(); });
+        CHECK(ring > 0);
+        CHECK(locked > 0);
+        CHECK(ring_batched > 0);
+        CHECK(locked_batched > 0);
+        std::cout << "  " << std::to_string(pairs) << std::string(7 - std::to_string(pairs).size(), ' ')
+                  << ring / 1e6 << "\t\t" << locked / 1e6 << "\t\t\t" << ring_batched / 1e6
+                  << "\t\t" << locked_batched / 1e6 << "\n";
+    }
+}
+
 int main() {
     test_single_sender_receiver();
     test_many_senders_one_receiver();
@@ -368,6 +477,7 @@ int main() {
     test_cancel_many_blocked_receivers();
     test_multi_producer_consumer_stress();
     test_one_million_messages();
+    bench_throughput();
     const int failed_count = failed.load();
     const int passed_count = passed.load();
     if (failed_count == 0) {
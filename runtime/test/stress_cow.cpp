@@ -0,0 +1,150 @@
+// COW buffers shared across threads (cow_detach.hpp): zero-copy hand-off of
+// Array / HashMap / PersistentMap copies to workers that read and mutate them.
+// Run under MLC_SANITIZE=thread to check the detach protocol.
+// g++ -std=c++20 -pthread -I../include -o stress_cow stress_cow.cpp
+
+#include "mlc/concurrency/channel.hpp"
+#include "mlc/core/array.hpp"
+#include "mlc/core/hashmap.hpp"
+#include "mlc/core/persistent_map.hpp"
+#include "mlc/core/string.hpp"
+
+#include <atomic>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+static std::atomic<int> passed{0};
+static std::atomic<int> failed{0};
+
+#define CHECK(expression) do { \
+    if (expression) { passed.fetch_add(1, std::memory_order_relaxed); } \
+    else { failed.fetch_add(1, std::memory_order_relaxed); std::cerr << "FAIL: " #expression " at line " << __LINE__ << "\n"; } \
+} while(0)
+
+static long array_sum(const mlc::Array<int>& array) {
+    long sum = 0;
+    for (int value : array) sum += value;
+    return sum;
+}
+
+// Every worker gets a copy of one buffer, reads it, then mutates its copy.
+// The original and the other workers' copies must be untouched.
+void test_fan_out_read_then_mutate() {
+    constexpr int worker_count = 8;
+    constexpr int length = 4096;
+    mlc::Array<int> original;
+    for (int i = 0; i < length; ++i) original.push_back(i);
+    const long expected_sum = array_sum(original);
+    std::vector<std::thread> workers;
+    for (int index = 0; index < worker_count; ++index) {
+        workers.emplace_back([copy = original, index, expected_sum]() mutable {
+            CHECK(array_sum(copy) == expected_sum);
+            for (int i = 0; i < 64; ++i) copy.set(static_cast<size_t>(i), -index);
+            copy.push_back(index);
+            CHECK(copy[0] == -index);
+            CHECK(copy.length() == length + 1);
+        });
+    }
+    for (auto& worker : workers) worker.join();
+    CHECK(original.length() == length);
+    CHECK(array_sum(original) == expected_sum);
+}
+
+// Two copies of one buffer: one thread reads its copy and drops it while the
+// other mutates. Whichever way the race goes the mutator ends up as the unique
+// owner or detaches; the reader must never see the writes.
+void test_drop_while_other_mutates() {
+    constexpr int rounds = 2000;
+    bool all_consistent = true;
+    for (int round = 0; round < rounds; ++round) {
+        mlc::Array<int> reader_copy;
+        for (int i = 0; i < 32; ++i) reader_copy.push_back(i);
+        mlc::Array<int> writer_copy = reader_copy;
+        long observed = 0;
+        std::thread reader([&] {
+            observed = array_sum(reader_copy);
+            reader_copy = mlc::Array<int>();
+        });
+        std::thread writer([&] {
+            for (int i = 0; i < 32; ++i) writer_copy.set(static_cast<size_t>(i), -1);
+        });
+        reader.join();
+        writer.join();
+        all_consistent = all_consistent && observed == 496 && array_sum(writer_copy) == -32;
+    }
+    CHECK(all_consistent);
+}
+
+void test_hashmap_through_channel() {
+    constexpr int consumer_count = 4;
+    constexpr int messages = 400;
+    mlc::HashMap<mlc::String, int> table;
+    for (int i = 0; i < 1000; ++i) table.set(mlc::String("key_" + std::to_string(i)), i);
+    mlc::concurrency::Channel<mlc::HashMap<mlc::String, int>> channel(16);
+    std::atomic<int> received{0};
+    std::vector<std::thread> consumers;
+    for (int index = 0; index < consumer_count; ++index) {
+        consumers.emplace_back([&, index] {
+            while (true) {
+                auto message = channel.receive();
+                if (!message.has_value()) break;
+                auto map = std::move(*message);
+                CHECK(map.get(mlc::String("key_999")) == 999);
+                map.set(mlc::String("key_0"), -index);
+                map.remove(mlc::String("key_1"));
+                CHECK(map.size() == 999);
+                received.fetch_add(1, std::memory_order_relaxed);
+            }
+        });
+    }
+    for (int i = 0; i < messages; ++i) CHECK(channel.send(table));
+    channel.close();
+    for (auto& consumer : consumers) consumer.join();
+    CHECK(received.load() == messages);
+    CHECK(table.size() == 1000);
+    CHECK(table.get(mlc::String("key_0")) == 0);
+    CHECK(table.has(mlc::String("key_1")));
+}
+
+// Workers fork a shared persistent scope; path copies on one side must not
+// leak into sibling forks or the parent.
+void test_persistent_map_forks() {
+    constexpr int worker_count = 8;
+    mlc::PersistentMap<int, int> parent;
+    for (int i = 0; i < 5000; ++i) parent.set(i, i);
+    std::vector<std::thread> workers;
+    for (int index = 0; index < worker_count; ++index) {
+        workers.emplace_back([fork = parent, index]() mutable {
+            for (int depth = 0; depth < 200; ++depth) {
+                auto child = fork;
+                child.set((index + 1) * 10000 + depth, depth);
+                child.set(depth, -index);
+                fork = child;
+            }
+            CHECK(fork.size() == 5200);
+            CHECK(fork.get(0) == -index);
+            CHECK(fork.get(4999) == 4999);
+        });
+    }
+    for (auto& worker : workers) worker.join();
+    CHECK(parent.size() == 5000);
+    CHECK(parent.get(0) == 0);
+}
+
+int main() {
+    test_fan_out_read_then_mutate();
+    test_drop_while_other_mutates();
+    test_hashmap_through_channel();
+    test_persistent_map_forks();
+    const int failed_count = failed.load();
+    const int passed_count = passed.load();
+    if (failed_count == 0) {
+        std::cout << "ALL " << passed_count << " checks PASSED\n";
+    } else {
+        std::cout << passed_count << " passed, " << failed_count << " FAILED\n";
+    }
+    return failed_count > 0 ? 1 : 0;
+}
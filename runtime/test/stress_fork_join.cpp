@@ -0,0 +1,206 @@
+// Fork/join on ThreadPool: parallel fib and parallel sum, checked against the
+// sequential result, plus timings for work stealing vs the shared-queue pool,
+// the shared runtime executor, and one std::async thread per child.
+// g++ -std=c++20 -O2 -pthread -I../include -o stress_fork_join stress_fork_join.cpp
+
+#include "mlc/concurrency/task_scope.hpp"
+#include "mlc/concurrency/thread_pool.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <future>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+using mlc::concurrency::PoolScheduling;
+using mlc::concurrency::TaskScope;
+using mlc::concurrency::ThreadPool;
+
+static std::atomic<int> passed{0};
+static std::atomic<int> failed{0};
+
+#define CHECK(expression) do { \
+    if (expression) { passed.fetch_add(1, std::memory_order_relaxed); } \
+    else { failed.fetch_add(1, std::memory_order_relaxed); std::cerr << "FAIL: " #expression " at line " << __LINE__ << "\n"; } \
+} while(0)
+
+constexpr int fib_cutoff = 12;
+constexpr int64_t sum_grain = 4096;
+
+static int64_t fib_sequential(int n) {
+    return n < 2 ? n : fib_sequential(n - 1) + fib_sequential(n - 2);
+}
+
+// pool == nullptr: plain TaskScope on the shared runtime executor.
+static int64_t fib_parallel(ThreadPool* pool, int n) {
+    if (n <= fib_cutoff) return fib_sequential(n);
+    int64_t left = 0;
+    int64_t right = 0;
+    {
+        TaskScope scope = pool != nullptr ? TaskScope(*pool) : TaskScope();
+        scope.spawn([&] { left = fib_parallel(pool, n - 1); });
+        right = fib_parallel(pool, n - 2);
+    }
+    return left + right;
+}
+
+// The pre-executor TaskScope: one std::async thread per child.
+static int64_t fib_thread_per_child(int n) {
+    if (n <= fib_cutoff) return fib_sequential(n);
+    auto left = std::async(std::launch::async, [n] { return fib_thread_per_child(n - 1); });
+    const int64_t right = fib_thread_per_child(n - 2);
+    return left.get() + right;
+}
+
+static int64_t sum_range(const std::vector<int32_t>& values, int64_t low, int64_t high) {
+    int64_t sum = 0;
+    for (int64_t index = low; index < high; ++index) sum += values[static_cast<size_t>(index)];
+    return sum;
+}
+
+static int64_t sum_fork_join(ThreadPool& pool, const std::vector<int32_t>& values, int64_t low, int64_t high) {
+    if (high - low <= sum_grain) return sum_range(values, low, high);
+    const int64_t middle = low + (high - low) / 2;
+    int64_t left = 0;
+    int64_t right = 0;
+    {
+        TaskScope scope(pool);
+        scope.spawn([&] { left = sum_fork_join(pool, values, low, middle); });
+        right = sum_fork_join(pool, values, middle, high);
+    }
+    return left + right;
+}
+
+// Flat split: one external submit per chunk, completion counted on an atomic.
+// Works in both pool modes (no job waits on another).
+static int64_t sum_flat(ThreadPool& pool, const std::vector<int32_t>& values) {
+    const int64_t length = static_cast<int64_t>(values.size());
+    const int64_t chunks = (length + sum_grain - 1) / sum_grain;
+    std::atomic<int64_t> total{0};
+    std::atomic<int64_t> remaining{chunks};
+    for (int64_t chunk = 0; chunk < chunks; ++chunk) {
+        const int64_t low = chunk * sum_grain;
+        const int64_t high = low + sum_grain < length ? low + sum_grain : length;
+        pool.submit([&, low, high] {
+            total.fetch_add(sum_range(values, low, high), std::memory_order_relaxed);
+            remaining.fetch_sub(1, std::memory_order_release);
+        });
+    }
+    while (remaining.load(std::memory_order_acquire) != 0) {
+        if (!pool.help_one()) std::this_thread::yield();
+    }
+    return total.load();
+}
+
+template<typename Body>
+static double elapsed_ms(Body&& body) {
+    const auto start = std::chrono::steady_clock::now();
+    body();
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Run `body` as a single root job on the pool, the usual fork/join entry point.
+template<typename Body>
+static void run_on_pool(ThreadPool& pool, Body&& body) {
+    std::atomic<bool> done{false};
+    CHECK(pool.submit([&] {
+        body();
+        done.store(true, std::memory_order_release);
+    }));
+    while (!done.load(std::memory_order_acquire)) std::this_thread::yield();
+}
+
+void test_fib_matches_sequential(size_t workers) {
+    ThreadPool pool(workers, 64, PoolScheduling::WorkStealing);
+    for (int n : {0, 1, 13, 20, 24}) {
+        int64_t result = -1;
+        run_on_pool(pool, [&] { result = fib_parallel(&pool, n); });
+        CHECK(result == fib_sequential(n));
+    }
+    CHECK(fib_parallel(&pool, 22) == fib_sequential(22)); // root on a non-worker thread
+    CHECK(fib_parallel(nullptr, 22) == fib_sequential(22));
+}
+
+void test_sum_matches_sequential(size_t workers) {
+    std::vector<int32_t> values(1 << 20);
+    for (size_t index = 0; index < values.size(); ++index) values[index] = static_cast<int32_t>(index % 1000) - 500;
+    const int64_t expected = sum_range(values, 0, static_cast<int64_t>(values.size()));
+    ThreadPool stealing(workers, 64, PoolScheduling::WorkStealing);
+    int64_t result = 0;
+    run_on_pool(stealing, [&] { result = sum_fork_join(stealing, values, 0, static_cast<int64_t>(values.size())); });
+    CHECK(result == expected);
+    CHECK(sum_flat(stealing, values) == expected);
+    ThreadPool shared(workers, 64);
+    CHECK(sum_flat(shared, values) == expected);
+}
+
+// Read through a volatile so the sequential baseline is not folded at compile time.
+static volatile int benchmark_fib_n = 30;
+static volatile int benchmark_thread_fib_n = 24;
+
+void benchmark(size_t workers) {
+    const int fib_n = benchmark_fib_n;
+    const int thread_fib_n = benchmark_thread_fib_n;
+    const int64_t fib_expected = fib_sequential(fib_n);
+    std::vector<int32_t> values(1 << 24);
+    for (size_t index = 0; index < values.size(); ++index) values[index] = static_cast<int32_t>(index & 0xff);
+    const int64_t sum_expected = sum_range(values, 0, static_cast<int64_t>(values.size()));
+
+    ThreadPool stealing(workers, 1024, PoolScheduling::WorkStealing);
+    ThreadPool shared(workers, 1024);
+    int64_t fib_stealing = 0;
+    int64_t sum_stealing = 0;
+    const double fib_sequential_ms = elapsed_ms([&] { CHECK(fib_sequential(fib_n) == fib_expected); });
+    const double fib_stealing_ms = elapsed_ms([&] {
+        run_on_pool(stealing, [&] { fib_stealing = fib_parallel(&stealing, fib_n); });
+    });
+    int64_t fib_small_stealing = 0;
+    int64_t fib_executor = 0;
+    int64_t fib_threads = 0;
+    const double fib_small_stealing_ms = elapsed_ms([&] {
+        run_on_pool(stealing, [&] { fib_small_stealing = fib_parallel(&stealing, thread_fib_n); });
+    });
+    const double fib_executor_ms = elapsed_ms([&] { fib_executor = fib_parallel(nullptr, fib_n); });
+    const double fib_threads_ms = elapsed_ms([&] { fib_threads = fib_thread_per_child(thread_fib_n); });
+    const double sum_fork_join_ms = elapsed_ms([&] {
+        run_on_pool(stealing, [&] {
+            sum_stealing = sum_fork_join(stealing, values, 0, static_cast<int64_t>(values.size()));
+        });
+    });
+    int64_t flat_stealing = 0;
+    int64_t flat_shared = 0;
+    const double flat_stealing_ms = elapsed_ms([&] { flat_stealing = sum_flat(stealing, values); });
+    const double flat_shared_ms = elapsed_ms([&] { flat_shared = sum_flat(shared, values); });
+    CHECK(fib_stealing == fib_expected && fib_executor == fib_expected);
+    CHECK(fib_threads == fib_sequential(thread_fib_n) && fib_small_stealing == fib_threads);
+    CHECK(sum_stealing == sum_expected);
+    CHECK(flat_stealing == sum_expected && flat_shared == sum_expected);
+
+    std::cout << "  fork/join (" << workers << " workers, ms)\n"
+              << "  fib(" << fib_n << ") cutoff " << fib_cutoff << ": sequential " << fib_sequential_ms
+              << ", work stealing " << fib_stealing_ms << ", runtime executor " << fib_executor_ms << "\n"
+              << "  fib(" << thread_fib_n << "): work stealing " << fib_small_stealing_ms
+              << ", thread per child " << fib_threads_ms << "\n"
+              << "  sum(" << values.size() << ") grain " << sum_grain << ": fork/join stealing "
+              << sum_fork_join_ms << ", flat stealing " << flat_stealing_ms << ", flat shared queue "
+              << flat_shared_ms << "\n";
+}
+
+int main() {
+    const size_t hardware = static_cast<size_t>(mlc::concurrency::default_worker_count());
+    for (size_t workers : {size_t{1}, size_t{2}, size_t{4}}) {
+        test_fib_matches_sequential(workers);
+        test_sum_matches_sequential(workers);
+    }
+    benchmark(hardware < 4 ? 4 : hardware);
+    const int failed_count = failed.load();
+    const int passed_count = passed.load();
+    if (failed_count == 0) {
+        std::cout << "ALL " << passed_count << " checks PASSED\n";
+    } else {
+        std::cout << passed_count << " passed, " << failed_count << " FAILED\n";
+    }
+    return failed_count > 0 ? 1 : 0;
+}
@@ -1,13 +1,19 @@
 // spawn_task stress (TRACK_CONCURRENCY_TEST_HARNESS STEP=3).
-// g++ -std=c++20 -pthread -I../include -o stress_spawn stress_spawn.cpp
+// Spawn-latency benchmark: runtime executor vs one std::async thread per spawn
+// (the pre-executor spawn_task), for one-at-a-time spawns and a burst.
+// g++ -std=c++20 -O2 -pthread -I../include -o stress_spawn stress_spawn.cpp
 
 #include "mlc/concurrency/spawn.hpp"
 #include "mlc/core/task.hpp"
 
+#include <algorithm>
 #include <atomic>
+#include <chrono>
+#include <future>
 #include <iostream>
 #include <stdexcept>
 #include <string>
+#include <thread>
 #include <vector>
 
 static std::atomic<int> passed{0};
@@ -65,10 +71,115 @@ void test_spawn_results_under_load() {
     CHECK(hits.load() == rounds * 8);
 }
 
+void test_burst_of_short_spawns() {
+    constexpr int task_count = 10000;
+    std::vector<mlc::Task<int>> tasks;
+    tasks.reserve(task_count);
+    for (int index = 0; index < task_count; ++index) {
+        tasks.push_back(mlc::concurrency::spawn_task([index] { return index & 1; }));
+    }
+    int odd = 0;
+    for (auto& task : tasks) odd += mlc::block_on(task);
+    CHECK(odd == task_count / 2);
+    CHECK(mlc::concurrency::runtime_executor().worker_count() <= mlc::concurrency::kRuntimeExecutorMaxWorkers);
+}
+
+using Clock = std::chrono::steady_clock;
+
+static double micros(Clock::duration duration) {
+    return std::chrono::duration<double, std::micro>(duration).count();
+}
+
+struct LatencyReport {
+    double median_us = 0;
+    double p99_us = 0;
+    double total_ms = 0;
+};
+
+// Spawn-to-start latency: time from the spawn call until the body runs.
+// `sequential` waits until each body has run (polling, so block_on cannot
+// claim it inline) before the next spawn; otherwise all are spawned first
+// (burst) and awaited afterwards.
+template<typename Spawn>
+static LatencyReport measure_spawn_latency(int count, bool sequential, Spawn&& spawn) {
+    std::vector<double> latencies(static_cast<size_t>(count));
+    const auto start = Clock::now();
+    spawn(count, sequential, latencies);
+    const auto total = Clock::now() - start;
+    std::sort(latencies.begin(), latencies.end());
+    LatencyReport report;
+    report.median_us = latencies[latencies.size() / 2];
+    report.p99_us = latencies[latencies.size() * 99 / 100];
+    report.total_ms = micros(total) / 1000.0;
+    CHECK(report.median_us >= 0);
+    return report;
+}
+
+static void spawn_on_executor(int count, bool sequential, std::vector<double>& latencies) {
+    std::vector<mlc::Task<void>> tasks;
+    tasks.reserve(static_cast<size_t>(count));
+    std::atomic<int> started{0};
+    for (int index = 0; index < count; ++index) {
+        const auto spawned_at = Clock::now();
+        tasks.push_back(mlc::concurrency::spawn_task([&latencies, &started, index, spawned_at] {
+            latencies[static_cast<size_t>(index)] = micros(Clock::now() - spawned_at);
+            started.fetch_add(1, std::memory_order_release);
+        }));
+        if (sequential) {
+            while (started.load(std::memory_order_acquire) <= index) std::this_thread::yield();
+        }
+    }
+    for (auto& task : tasks) mlc::block_on(task);
+}
+
+static void spawn_thread_each(int count, bool sequential, std::vector<double>& latencies) {
+    std::vector<std::future<void>> futures;
+    futures.reserve(static_cast<size_t>(count));
+    for (int index = 0; index < count; ++index) {
+        const auto spawned_at = Clock::now();
+        futures.push_back(std::async(std::launch::async, [&latencies, index, spawned_at] {
+            latencies[static_cast<size_t>(index)] = micros(Clock::now() - spawned_at);
+        }));
+        if (sequential) futures.back().wait();
+    }
+    for (auto& future : futures) future.get();
+}
+
+static void print_latency(const char* label, const LatencyReport& report) {
+    std::cout << "  " << label << ": median " << report.median_us << " us, p99 " << report.p99_us
+              << " us, total " << report.total_ms << " ms\n";
+}
+
+// Sanitizer runtimes keep per-thread shadow state; 10k live std::async
+// threads exhaust memory under TSAN, so the sample sizes shrink there.
+#if defined(__SANITIZE_THREAD__) || defined(__SANITIZE_ADDRESS__)
+constexpr int benchmark_sequential_count = 200;
+constexpr int benchmark_burst_count = 500;
+#else
+constexpr int benchmark_sequential_count = 2000;
+constexpr int benchmark_burst_count = 10000;
+#endif
+
+void benchmark_spawn_latency() {
+    constexpr int sequential_count = benchmark_sequential_count;
+    constexpr int burst_count = benchmark_burst_count;
+    // Warm the executor so its lazy start is not billed to the first sample.
+    auto warm = mlc::concurrency::spawn_task([] {});
+    mlc::block_on(warm);
+    std::cout << "  spawn latency (spawn call -> body start; " << sequential_count << " one at a time, "
+              << burst_count << " burst)\n";
+    print_latency("executor, one at a time  ", measure_spawn_latency(sequential_count, true, spawn_on_executor));
+    print_latency("std::async, one at a time", measure_spawn_latency(sequential_count, true, spawn_thread_each));
+    print_latency("executor, burst          ", measure_spawn_latency(burst_count, false, spawn_on_executor));
+    print_latency("std::async, burst        ", measure_spawn_latency(burst_count, false, spawn_thread_each));
+}
+
 int main() {
     test_many_concurrent_spawns();
     test_exception_inside_spawn_does_not_terminate();
     test_spawn_results_under_load();
+    test_burst_of_short_spawns();
+    benchmark_spawn_latency();
     const int failed_count = failed.load();
     const int passed_count = passed.load();
     if (failed_count == 0) {
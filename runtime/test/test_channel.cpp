@@ -3,11 +3,13 @@
 
 #include "mlc/concurrency/channel.hpp"
 #include "mlc/core/string.hpp"
+#include <algorithm>
 #include <atomic>
 #include <chrono>
 #include <iostream>
 #include <optional>
 #include <thread>
+#include <vector>
 
 static int passed = 0;
 static int failed = 0;
@@ -80,6 +82,24 @@ void test_bounded_try_send() {
     CHECK(value.has_value() && *value == 1);
 }
 
+// Capacities that are not a power of two stay exact on every lap of the ring.
+void test_bounded_capacity_exact_across_laps() {
+    mlc::concurrency::Channel<int> channel(3);
+    bool exact = true;
+    int next_sent = 0;
+    int next_received = 0;
+    for (int lap = 0; lap < 5; ++lap) {
+        while (channel.try_send(next_sent)) ++next_sent;
+        exact = exact && channel.size() == 3 && next_sent - next_received == 3;
+        for (int taken = 0; taken < 2; ++taken) {
+            auto value = channel.try_receive();
+            exact = exact && value.has_value() && *value == next_received++;
+        }
+    }
+    CHECK(exact);
+    CHECK(channel.size() == 1);
+}
+
 void test_copy_isolation() {
     mlc::concurrency::Channel<int> channel(4);
     int original = 10;
@@ -236,6 +256,69 @@ void test_unbounded_accepts_past_fixed_capacity() {
     CHECK(channel.size() == 0);
 }
 
+// Batch send/receive on each backend: bounded ring, unbounded deque, rendezvous.
+template<typename MakeChannel>
+void check_batch_round_trip(MakeChannel make_channel) {
+    auto channel = make_channel();
+    mlc::Array<int> values;
+    for (int index = 0; index < 1000; ++index) values.push_back(index);
+    size_t sent = 0;
+    std::thread producer([&] {
+        sent = channel.send_many(values);
+        channel.close();
+    });
+    std::vector<int> received;
+    size_t largest_batch = 0;
+    while (true) {
+        auto batch = channel.receive_many(64);
+        if (batch.empty()) break;
+        largest_batch = std::max(largest_batch, batch.size());
+        for (int value : batch) received.push_back(value);
+    }
+    producer.join();
+    CHECK(sent == 1000);
+    CHECK(largest_batch <= 64);
+    bool in_order = received.size() == 1000;
+    for (size_t index = 0; index < received.size() && in_order; ++index)
+        in_order = received[index] == static_cast<int>(index);
+    CHECK(in_order);
+}
+
+void test_batch_round_trip() {
+    check_batch_round_trip([] { return mlc::concurrency::make_channel<int>(16); });
+    check_batch_round_trip([] { return mlc::concurrency::make_channel<int>(1); });
+    check_batch_round_trip([] { return mlc::concurrency::make_channel<int>(5); });
+    check_batch_round_trip([] { return mlc::concurrency::make_unbounded_channel<int>(); });
+    check_batch_round_trip([] { return mlc::concurrency::make_channel<int>(0); });
+}
+
+void test_receive_many_drains_available() {
+    mlc::concurrency::Channel<int> channel(8);
+    CHECK(channel.send_many(mlc::Array<int>{1, 2, 3}) == 3);
+    CHECK(channel.receive_many(0).empty());
+    auto first = channel.receive_many(2);
+    CHECK(first.size() == 2 && first[0] == 1 && first[1] == 2);
+    auto second = channel.receive_many(10);
+    CHECK(second.size() == 1 && second[0] == 3);
+    channel.close();
+    CHECK(channel.receive_many(10).empty());
+}
+
+void test_send_many_stops_at_close() {
+    auto [sender, receiver] = mlc::concurrency::open_channel<int>(4);
+    mlc::Array<int> values;
+    for (int index = 0; index < 10; ++index) values.push_back(index);
+    size_t sent = 0;
+    std::thread producer([&] { sent = sender.send_many(values); });
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    sender.close();
+    producer.join();
+    CHECK(sent == 4);
+    auto drained = receiver.receive_many(10);
+    CHECK(drained.size() == 4 && drained[3] == 3);
+    CHECK(receiver.receive_many(10).empty());
+}
+
 int main() {
     test_capacity_validation();
     test_rendezvous_handoff();
@@ -243,6 +326,7 @@ int main() {
     test_rendezvous_close_unblocks_recv();
     test_rendezvous_try_send_without_receiver();
     test_bounded_try_send();
+    test_bounded_capacity_exact_across_laps();
     test_copy_isolation();
     test_close_blocks_send();
     test_receive_after_close_empty();
@@ -256,6 +340,9 @@ int main() {
     test_cancel_unblocks_send_when_full();
     test_cancellable_send_receive_ok();
     test_unbounded_accepts_past_fixed_capacity();
+    test_batch_round_trip();
+    test_receive_many_drains_available();
+    test_send_many_stops_at_close();
 
     if (failed == 0) {
         std::cout << "ALL " << passed << " checks PASSED\n";
@@ -0,0 +1,127 @@
+// mlc::HashMap over the open-addressing FlatHashTable backend.
+// g++ -std=c++20 -I../include -o test_hashmap test_hashmap.cpp
+
+#include "mlc/core/hashmap.hpp"
+#include "mlc/core/string.hpp"
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <string>
+#include <unordered_map>
+
+static int passed = 0;
+static int failed = 0;
+
+#define CHECK(expr) do { \
+    if (expr) { ++passed; } \
+    else { ++failed; std::cerr << "FAIL: " #expr " at line " << __LINE__ << "\n"; } \
+} while(0)
+
+void test_basic_operations() {
+    mlc::HashMap<mlc::String, int> map;
+    CHECK(map.empty());
+    CHECK(!map.has(mlc::String("missing")));
+    CHECK(map.get(mlc::String("missing")) == 0);
+    map.set(mlc::String("alpha"), 1);
+    map.set(mlc::String("a key long enough to live on the heap"), 2);
+    map.set(mlc::String("alpha"), 3);
+    CHECK(map.size() == 2);
+    CHECK(map.get(mlc::String("alpha")) == 3);
+    CHECK(map.get(mlc::String("a key long enough to live on the heap")) == 2);
+    CHECK(map.get_or(mlc::String("alpha"), -1) == 3);
+    CHECK(mlc::map_get_or(map, mlc::String("missing"), -1) == -1);
+    // The cast an extern binding emits (compiler/infrastructure/intern.mlc).
+    auto lookup_or = static_cast<int (*)(mlc::HashMap<mlc::String, int>, mlc::String, int)>(&mlc::map_get_or);
+    CHECK(lookup_or(map, mlc::String("alpha"), -1) == 3);
+    map.remove(mlc::String("alpha"));
+    map.remove(mlc::String("never there"));
+    CHECK(map.size() == 1);
+    CHECK(!map.has(mlc::String("alpha")));
+}
+
+void test_insertion_order() {
+    mlc::HashMap<mlc::String, int> map;
+    for (int i = 0; i < 100; ++i) map.set(mlc::String("k" + std::to_string(i)), i);
+    auto keys = map.keys();
+    bool in_order = keys.length() == 100;
+    for (int i = 0; i < keys.length() && in_order; ++i)
+        in_order = keys[i] == mlc::String("k" + std::to_string(i));
+    CHECK(in_order);
+    int expected = 0;
+    bool values_in_order = true;
+    for (const auto& [key, value] : map) values_in_order = values_in_order && value == expected++;
+    CHECK(values_in_order);
+}
+
+void test_cow_copy_is_isolated() {
+    mlc::HashMap<int, int> original;
+    for (int i = 0; i < 40; ++i) original.set(i, i);
+    mlc::HashMap<int, int> copy = original;
+    copy.remove(3);
+    copy.set(100, 100);
+    CHECK(original.size() == 40);
+    CHECK(original.has(3));
+    CHECK(!original.has(100));
+    CHECK(copy.size() == 40);
+    CHECK(!copy.has(3));
+}
+
+// Random set/remove/lookup against std::unordered_map, with enough churn to
+// exercise growth, tombstone rebuilds and the swap-on-remove index fixup.
+void test_matches_reference() {
+    std::mt19937 random(12345);
+    mlc::HashMap<int, int> map;
+    std::unordered_map<int, int> reference;
+    bool consistent = true;
+    for (int step = 0; step < 200000 && consistent; ++step) {
+        int key = static_cast<int>(random() % 5000);
+        switch (random() % 4) {
+            case 0:
+            case 1:
+                map.set(key, step);
+                reference[key] = step;
+                break;
+            case 2:
+                map.remove(key);
+                reference.erase(key);
+                break;
+            default: {
+                auto it = reference.find(key);
+                consistent = map.has(key) == (it != reference.end())
+                    && (it == reference.end() || map.get(key) == it->second);
+            }
+        }
+        consistent = consistent && map.size() == reference.size();
+    }
+    CHECK(consistent);
+    size_t visited = 0;
+    bool entries_match = true;
+    for (const auto& [key, value] : map) {
+        ++visited;
+        auto it = reference.find(key);
+        entries_match = entries_match && it != reference.end() && it->second == value;
+    }
+    CHECK(entries_match);
+    CHECK(visited == reference.size());
+}
+
+void test_string_hash_uses_bytes() {
+    mlc::String sso("short");
+    mlc::String heap(std::string(40, 'h'));
+    CHECK(std::hash<mlc::String>{}(sso) == std::hash<std::string_view>{}("short"));
+    CHECK(std::hash<mlc::String>{}(heap) == std::hash<std::string>{}(std::string(40, 'h')));
+}
+
+int main() {
+    test_basic_operations();
+    test_insertion_order();
+    test_cow_copy_is_isolated();
+    test_matches_reference();
+    test_string_hash_uses_bytes();
+    if (failed == 0) {
+        std::cout << "ALL " << passed << " checks PASSED\n";
+    } else {
+        std::cout << passed << " passed, " << failed << " FAILED\n";
+    }
+    return failed > 0 ? 1 : 0;
+}
@@ -30,6 +30,27 @@ void test_enqueue_n_jobs() {
   }
 }
 
+void test_work_stealing_pool_retries() {
+  std::atomic<int> attempts{0};
+  std::atomic<int> counter{0};
+  {
+    mlc::concurrency::JobQueue queue(
+        2, 8, 2, mlc::concurrency::PoolScheduling::WorkStealing);
+    for (int index = 0; index < 40; ++index) {
+      CHECK(queue.enqueue([&] { counter.fetch_add(1); }));
+    }
+    CHECK(queue.enqueue([&] {
+      if (attempts.fetch_add(1) == 0) {
+        throw std::runtime_error("retry");
+      }
+    }));
+    queue.wait_idle();
+    queue.shutdown();
+  }
+  CHECK(counter.load() == 40);
+  CHECK(attempts.load() == 2);
+}
+
 void test_schedule_after_runs_later() {
   std::atomic<int> counter{0};
   const auto start = std::chrono::steady_clock::now();
@@ -75,6 +96,7 @@ void test_shutdown_drops_delayed() {
 
 int main() {
   test_enqueue_n_jobs();
+  test_work_stealing_pool_retries();
   test_schedule_after_runs_later();
   test_retry_on_exception();
   test_shutdown_drops_delayed();
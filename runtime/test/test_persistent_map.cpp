@@ -0,0 +1,187 @@
+// mlc::PersistentMap (HAMT) against std::unordered_map, plus structural sharing.
+// g++ -std=c++20 -I../include -o test_persistent_map test_persistent_map.cpp
+
+#include "mlc/core/persistent_map.hpp"
+#include "mlc/core/string.hpp"
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+static int passed = 0;
+static int failed = 0;
+
+#define CHECK(expr) do { \
+    if (expr) { ++passed; } \
+    else { ++failed; std::cerr << "FAIL: " #expr " at line " << __LINE__ << "\n"; } \
+} while(0)
+
+// Every key hashes to the same value: forces collision nodes at full depth.
+struct ConstantHash {
+    size_t operator()(int) const noexcept { return 42; }
+};
+
+template<typename Map, typename Reference>
+static bool same_contents(const Map& map, const Reference& reference) {
+    if (map.size() != reference.size()) return false;
+    size_t visited = 0;
+    for (const auto& [key, value] : map) {
+        ++visited;
+        auto it = reference.find(key);
+        if (it == reference.end() || it->second != value) return false;
+    }
+    return visited == reference.size();
+}
+
+void test_basic_operations() {
+    mlc::PersistentMap<mlc::String, int> map;
+    CHECK(map.empty());
+    CHECK(map.begin() == map.end());
+    CHECK(!map.has(mlc::String("missing")));
+    CHECK(map.get(mlc::String("missing")) == 0);
+    map.set(mlc::String("alpha"), 1);
+    map.set(mlc::String("a key long enough to live on the heap"), 2);
+    map.set(mlc::String("alpha"), 3);
+    CHECK(map.size() == 2);
+    CHECK(map.get(mlc::String("alpha")) == 3);
+    CHECK(map.get(mlc::String("a key long enough to live on the heap")) == 2);
+    map.remove(mlc::String("alpha"));
+    map.remove(mlc::String("never there"));
+    CHECK(map.size() == 1);
+    CHECK(!map.has(mlc::String("alpha")));
+    CHECK(map.keys().length() == 1);
+    CHECK(map.values()[0] == 2);
+}
+
+// A child scope forked from a parent sees the parent's bindings; neither
+// side's later writes leak into the other.
+void test_forked_scopes_are_isolated() {
+    mlc::PersistentMap<int, int> parent;
+    for (int i = 0; i < 1000; ++i) parent.set(i, i);
+    mlc::PersistentMap<int, int> child = parent;
+    child.set(5, -5);
+    child.set(2000, 2000);
+    child.remove(7);
+    parent.set(3000, 3000);
+    CHECK(parent.size() == 1001);
+    CHECK(parent.get(5) == 5);
+    CHECK(parent.has(7));
+    CHECK(!parent.has(2000));
+    CHECK(child.size() == 1000);
+    CHECK(child.get(5) == -5);
+    CHECK(!child.has(7));
+    CHECK(!child.has(3000));
+    CHECK(child.get(999) == 999);
+}
+
+void test_hash_collisions() {
+    mlc::PersistentMap<int, int, ConstantHash> map;
+    for (int i = 0; i < 10; ++i) map.set(i, i * 10);
+    mlc::PersistentMap<int, int, ConstantHash> copy = map;
+    map.set(3, 333);
+    map.remove(4);
+    CHECK(map.size() == 9);
+    CHECK(map.get(3) == 333);
+    CHECK(!map.has(4));
+    CHECK(copy.get(3) == 30);
+    CHECK(copy.has(4));
+    for (int i = 0; i < 10; ++i) map.remove(i);
+    CHECK(map.empty());
+    CHECK(map.begin() == map.end());
+    CHECK(copy.size() == 10);
+}
+
+// Random set/remove/lookup/fork against std::unordered_map. Snapshots taken
+// along the way must keep their contents after the live map moves on.
+void test_matches_reference() {
+    std::mt19937 random(2024);
+    mlc::PersistentMap<int, int> map;
+    std::unordered_map<int, int> reference;
+    std::vector<std::pair<mlc::PersistentMap<int, int>, std::unordered_map<int, int>>> snapshots;
+    bool consistent = true;
+    for (int step = 0; step < 200000 && consistent; ++step) {
+        int key = static_cast<int>(random() % 5000);
+        switch (random() % 4) {
+            case 0:
+            case 1:
+                map.set(key, step);
+                reference[key] = step;
+                break;
+            case 2:
+                map.remove(key);
+                reference.erase(key);
+                break;
+            default: {
+                auto it = reference.find(key);
+                consistent = map.has(key) == (it != reference.end())
+                    && (it == reference.end() || map.get(key) == it->second);
+            }
+        }
+        consistent = consistent && map.size() == reference.size();
+        if (step % 20000 == 0) snapshots.emplace_back(map, reference);
+    }
+    CHECK(consistent);
+    CHECK(same_contents(map, reference));
+    bool snapshots_intact = true;
+    for (const auto& [snapshot, expected] : snapshots)
+        snapshots_intact = snapshots_intact && same_contents(snapshot, expected);
+    CHECK(snapshots_intact);
+}
+
+// Removing everything collapses the trie back to the shape of an empty map,
+// and re-inserting works from there.
+void test_remove_all_then_reuse() {
+    mlc::PersistentMap<int, int> map;
+    for (int i = 0; i < 5000; ++i) map.set(i, i);
+    for (int i = 0; i < 5000; ++i) map.remove(i);
+    CHECK(map.empty());
+    CHECK(map.begin() == map.end());
+    map.set(17, 34);
+    CHECK(map.size() == 1);
+    CHECK(map.get(17) == 34);
+}
+
+// Nested scopes: each level forks its parent and binds a few names. With the
+// HAMT the cost per level is independent of the parent's size.
+void bench_forked_scopes() {
+    constexpr int kGlobals = 5000;
+    constexpr int kDepth = 500;
+    auto run = [](auto empty_map) {
+        auto scope = empty_map;
+        for (int i = 0; i < kGlobals; ++i) scope.set(mlc::String("global_" + std::to_string(i)), i);
+        auto start = std::chrono::steady_clock::now();
+        int found = 0;
+        for (int depth = 0; depth < kDepth; ++depth) {
+            auto child = scope;
+            child.set(mlc::String("local_" + std::to_string(depth)), depth);
+            found += child.has(mlc::String("global_0")) ? 1 : 0;
+            scope = child;
+        }
+        auto elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start);
+        return std::make_pair(elapsed.count(), found);
+    };
+    auto [hamt_ms, hamt_found] = run(mlc::PersistentMap<mlc::String, int>());
+    auto [cow_ms, cow_found] = run(mlc::HashMap<mlc::String, int>());
+    CHECK(hamt_found == kDepth);
+    CHECK(cow_found == kDepth);
+    std::cout << "  forked scopes (" << kGlobals << " globals, depth " << kDepth << "): "
+              << "PersistentMap " << hamt_ms << " ms, HashMap " << cow_ms << " ms\n";
+}
+
+int main() {
+    test_basic_operations();
+    test_forked_scopes_are_isolated();
+    test_hash_collisions();
+    test_matches_reference();
+    test_remove_all_then_reuse();
+    bench_forked_scopes();
+    if (failed == 0) {
+        std::cout << "ALL " << passed << " checks PASSED\n";
+    } else {
+        std::cout << passed << " passed, " << failed << " FAILED\n";
+    }
+    return failed > 0 ? 1 : 0;
+}
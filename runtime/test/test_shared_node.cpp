@@ -0,0 +1,97 @@
+// Canonical Shared<T> leaves for field-less alternatives (shared_node.hpp).
+// g++ -std=c++20 -pthread -I../include -o test_shared_node test_shared_node.cpp
+
+#include "mlc/core/shared_node.hpp"
+#include <iostream>
+#include <string>
+#include <thread>
+#include <variant>
+#include <vector>
+
+static int passed = 0;
+static int failed = 0;
+
+#define CHECK(expr) do { \
+    if (expr) { ++passed; } \
+    else { ++failed; std::cerr << "FAIL: " #expr " at line " << __LINE__ << "\n"; } \
+} while(0)
+
+struct TI32 {};
+struct TUnknown {};
+struct TNamed { std::string name; };
+// Not default-constructible; shared_leaf must still compile for this Type.
+struct TFixed { explicit TFixed(int tag) : tag(tag) {} int tag; };
+using Type = std::variant<TI32, TUnknown, TNamed, TFixed>;
+
+static_assert(mlc::is_leaf_alternative_v<Type, 0>);
+static_assert(mlc::is_leaf_alternative_v<Type, 1>);
+static_assert(!mlc::is_leaf_alternative_v<Type, 2>);
+static_assert(!mlc::is_leaf_alternative_v<Type, 3>);
+
+void test_same_alternative_shares_node() {
+    auto first = mlc::shared_leaf(Type{TUnknown{}});
+    auto second = mlc::shared_leaf(Type{TUnknown{}});
+    CHECK(first.get() == second.get());
+    CHECK(std::holds_alternative<TUnknown>(*first));
+    CHECK(mlc::shared_same(first, second));
+    // The casts the extern bindings in registry_type.mlc emit.
+    auto bound_leaf = static_cast<std::shared_ptr<Type> (*)(Type)>(&mlc::shared_leaf);
+    auto bound_same = static_cast<bool (*)(std::shared_ptr<Type>, std::shared_ptr<Type>)>(&mlc::shared_same);
+    CHECK(bound_same(bound_leaf(Type{TUnknown{}}), first));
+}
+
+void test_distinct_alternatives_distinct_nodes() {
+    auto unknown = mlc::shared_leaf(Type{TUnknown{}});
+    auto i32 = mlc::shared_leaf(Type{TI32{}});
+    CHECK(!mlc::shared_same(unknown, i32));
+    CHECK(std::holds_alternative<TI32>(*i32));
+}
+
+void test_make_shared_stays_fresh() {
+    auto canonical = mlc::shared_leaf(Type{TUnknown{}});
+    auto fresh = std::make_shared<Type>(TUnknown{});
+    CHECK(!mlc::shared_same(canonical, fresh));
+    CHECK(mlc::shared_same(fresh, fresh));
+    // A caller holding a weak reference to its own node still sees it expire.
+    std::weak_ptr<Type> observer = fresh;
+    fresh.reset();
+    CHECK(observer.expired());
+}
+
+void test_alternative_with_fields_keeps_value() {
+    auto named = mlc::shared_leaf(Type{TNamed{"x"}});
+    auto again = mlc::shared_leaf(Type{TNamed{"x"}});
+    CHECK(std::get<TNamed>(*named).name == "x");
+    CHECK(!mlc::shared_same(named, again));
+    auto fixed = mlc::shared_leaf(Type{TFixed{7}});
+    CHECK(fixed && std::get<TFixed>(*fixed).tag == 7);
+}
+
+void test_concurrent_first_use() {
+    std::vector<const Type*> seen(8, nullptr);
+    std::vector<std::thread> threads;
+    for (size_t index = 0; index < seen.size(); ++index) {
+        threads.emplace_back([&seen, index] {
+            seen[index] = mlc::shared_leaf(Type{TI32{}}).get();
+        });
+    }
+    for (auto& thread : threads) thread.join();
+    bool all_same = true;
+    for (const Type* node : seen) all_same = all_same && node == seen[0];
+    CHECK(all_same);
+    CHECK(std::holds_alternative<TI32>(*seen[0]));
+}
+
+int main() {
+    test_same_alternative_shares_node();
+    test_distinct_alternatives_distinct_nodes();
+    test_make_shared_stays_fresh();
+    test_alternative_with_fields_keeps_value();
+    test_concurrent_first_use();
+    if (failed == 0) {
+        std::cout << "ALL " << passed << " checks PASSED\n";
+    } else {
+        std::cout << passed << " passed, " << failed << " FAILED\n";
+    }
+    return failed > 0 ? 1 : 0;
+}
@@ -1,9 +1,15 @@
 // spawn_task + Task smoke (TRACK_CONCURRENCY STEP=3).
 // g++ -std=c++20 -pthread -I../include -o test_spawn test_spawn.cpp
 
+#include "mlc/concurrency/channel.hpp"
 #include "mlc/concurrency/spawn.hpp"
 #include "mlc/core/task.hpp"
+#include <atomic>
+#include <chrono>
 #include <iostream>
+#include <stdexcept>
+#include <thread>
+#include <vector>
 
 static int passed = 0;
 static int failed = 0;
@@ -25,9 +31,90 @@ void test_spawn_task_void() {
     CHECK(counter == 7);
 }
 
+void test_spawn_task_on_pool() {
+    mlc::concurrency::ThreadPool pool(2, 4, mlc::concurrency::PoolScheduling::WorkStealing);
+    mlc::Task<int> task = mlc::concurrency::spawn_task(pool, [] { return 6 * 7; });
+    CHECK(mlc::block_on(task) == 42);
+    int counter = 0;
+    mlc::Task<void> side_effect = mlc::concurrency::spawn_task(pool, [&] { counter = 3; });
+    mlc::block_on(side_effect);
+    CHECK(counter == 3);
+}
+
+// Spawn inside spawned work and block on it: the child is claimed inline when
+// no worker is free, so this cannot deadlock on a one-worker executor.
+void test_nested_spawn_block_on() {
+    mlc::Task<int> outer = mlc::concurrency::spawn_task([] {
+        mlc::Task<int> inner = mlc::concurrency::spawn_task([] { return 20; });
+        return mlc::block_on(inner) + 1;
+    });
+    CHECK(mlc::block_on(outer) == 21);
+}
+
+// Dropping a Task without awaiting it still waits for the work.
+void test_dropped_task_joins_work() {
+    std::atomic<bool> ran{false};
+    {
+        mlc::Task<void> task = mlc::concurrency::spawn_task([&] {
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+            ran.store(true);
+        });
+    }
+    CHECK(ran.load());
+}
+
+// is_ready follows the spawned work, so a loop can poll without block_on.
+void test_is_ready_without_block_on() {
+    std::atomic<bool> release{false};
+    mlc::Task<int> task = mlc::concurrency::spawn_task([&] {
+        while (!release.load()) std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        return 5;
+    });
+    CHECK(!mlc::is_ready(task));
+    release.store(true);
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (!mlc::is_ready(task) && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    CHECK(mlc::is_ready(task));
+    CHECK(mlc::block_on(task) == 5);
+    mlc::Task<void> thrower = mlc::concurrency::spawn_task([]() -> void { throw std::runtime_error("boom"); });
+    while (!mlc::is_ready(thrower)) std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    bool rethrown = false;
+    try { mlc::block_on(thrower); } catch (const std::runtime_error&) { rethrown = true; }
+    CHECK(rethrown);
+}
+
+// More blocked consumers than cores, producer spawned last and never joined
+// from here: the executor has to grow past its core-sized start for the
+// producer to run.
+void test_blocking_tasks_do_not_starve_executor() {
+    const int consumer_count = mlc::concurrency::default_worker_count() + 2;
+    auto channel = mlc::concurrency::make_channel<int>(4);
+    std::atomic<int> received{0};
+    std::vector<mlc::Task<void>> tasks;
+    for (int index = 0; index < consumer_count; ++index) {
+        tasks.push_back(mlc::concurrency::spawn_task([channel, &received]() mutable {
+            if (channel.receive().has_value()) received.fetch_add(1);
+        }));
+    }
+    tasks.push_back(mlc::concurrency::spawn_task([channel, consumer_count]() mutable {
+        for (int index = 0; index < consumer_count; ++index) channel.send(1);
+    }));
+    while (received.load() < consumer_count) std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    for (auto& task : tasks) mlc::block_on(task);
+    CHECK(received.load() == consumer_count);
+    CHECK(mlc::concurrency::runtime_executor().worker_count() > 1);
+}
+
 int main() {
     test_spawn_task_int();
     test_spawn_task_void();
+    test_spawn_task_on_pool();
+    test_nested_spawn_block_on();
+    test_dropped_task_joins_work();
+    test_is_ready_without_block_on();
+    test_blocking_tasks_do_not_starve_executor();
     if (failed == 0) {
         std::cout << "ALL " << passed << " checks PASSED\n";
     } else {
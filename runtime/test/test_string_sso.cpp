@@ -3,6 +3,7 @@
 //   g++ -std=c++20 -I../include -o test_string_sso test_string_sso.cpp ../src/core/string.cpp
 
 #include "mlc/core/string.hpp"
+#include "mlc/core/string_builder.hpp"
 #include <cassert>
 #include <iostream>
 #include <string>
@@ -327,6 +328,204 @@ void test_to_i() {
     std::cout << "\n";
 }
 
+// ── 13. operator+= — in place on a uniquely owned heap buffer ───────────────
+
+void test_append_in_place() {
+    SECTION("unique heap buffer grows in place");
+    { mlc::String s(std::string(30, 'a'));
+      s += mlc::String("b");
+      CHECK(s.byte_size() == 31);
+      CHECK(s.as_std_string().back() == 'b'); }
+    std::cout << "\n";
+
+    SECTION("shared heap buffer is not mutated");
+    { mlc::String a(std::string(30, 'a'));
+      mlc::String b = a;
+      b += mlc::String("!");
+      CHECK(a.byte_size() == 30);
+      CHECK(b.byte_size() == 31); }
+    std::cout << "\n";
+
+    SECTION("self append");
+    { mlc::String s(std::string(24, 'x'));
+      s += s;
+      CHECK(s.byte_size() == 48); }
+    std::cout << "\n";
+
+    SECTION("ascii flag follows appended piece");
+    { mlc::String s(std::string(30, 'a'));
+      s += mlc::String("é");
+      CHECK(s.length() == 31); }
+    std::cout << "\n";
+}
+
+// ── 14. StringBuilder ────────────────────────────────────────────────────────
+
+void test_string_builder() {
+    SECTION("append + finish");
+    { mlc::StringBuilder builder;
+      for (int i = 0; i < 100; ++i) builder.append(mlc::String("ab"));
+      CHECK(builder.length() == 200);
+      mlc::String s = builder.finish();
+      CHECK(s.byte_size() == 200);
+      CHECK(!s.is_sso());
+      CHECK(builder.is_empty()); }
+    std::cout << "\n";
+
+    SECTION("copies share one buffer");
+    { mlc::StringBuilder builder = mlc::string_builder_new();
+      mlc::StringBuilder alias = builder;
+      mlc::string_builder_append(alias, mlc::String("x"));
+      mlc::string_builder_append_line(builder, mlc::String("y"));
+      CHECK(mlc::string_builder_length(builder) == 3);
+      CHECK(mlc::string_builder_to_string(alias).as_std_string() == "xy\n"); }
+    std::cout << "\n";
+
+    SECTION("short result is SSO");
+    { mlc::StringBuilder builder = mlc::string_builder_with_capacity(64);
+      builder.append(mlc::String("hi"));
+      mlc::String s = mlc::string_builder_finish(builder);
+      CHECK(s.is_sso());
+      CHECK(s == mlc::String("hi")); }
+    std::cout << "\n";
+
+    SECTION("utf-8 length after finish");
+    { mlc::StringBuilder builder;
+      builder.append(mlc::String(std::string(30, 'a')));
+      builder.append(mlc::String("ж"));
+      CHECK(builder.finish().length() == 31); }
+    std::cout << "\n";
+}
+
+// ── 15. replace / repeat on uniquely owned buffers ──────────────────────────
+
+static std::string reference_replace(std::string text, const std::string& from, const std::string& to) {
+    size_t pos = 0;
+    while ((pos = text.find(from, pos)) != std::string::npos) {
+        text.replace(pos, from.size(), to);
+        pos += to.size();
+    }
+    return text;
+}
+
+void test_replace_repeat_in_place() {
+    SECTION("rvalue replace, shrinking");
+    { std::string base = "alpha-beta-gamma-delta-epsilon-zeta";
+      mlc::String s(base);
+      CHECK(std::move(s).replace(mlc::String("-"), mlc::String("")).as_std_string()
+            == reference_replace(base, "-", "")); }
+    std::cout << "\n";
+
+    SECTION("rvalue replace, growing");
+    { std::string base = "a.b.c.d.e.f.g.h.i.j.k.l.m.n.o.p";
+      mlc::String s(base);
+      CHECK(std::move(s).replace(mlc::String("."), mlc::String("::")).as_std_string()
+            == reference_replace(base, ".", "::")); }
+    std::cout << "\n";
+
+    SECTION("lvalue replace leaves the source alone");
+    { mlc::String a(std::string(30, 'x'));
+      mlc::String b = a;
+      mlc::String c = a.replace(mlc::String("x"), mlc::String("yy"));
+      CHECK(a.byte_size() == 30);
+      CHECK(b == a);
+      CHECK(c.byte_size() == 60); }
+    std::cout << "\n";
+
+    SECTION("replace matches every reference case");
+    { const char* texts[] = {"", "aaa", "abababababababababababab", "xaax", "no match in this long line at all"};
+      const char* froms[] = {"a", "aa", "ab", "x", "long"};
+      const char* tos[] = {"", "b", "aab", "xyzxyzxyzxyz", "a"};
+      bool all_match = true;
+      for (const char* text : texts)
+          for (const char* from : froms)
+              for (const char* to : tos) {
+                  std::string expected = reference_replace(text, from, to);
+                  mlc::String value(text);
+                  if (value.replace(mlc::String(from), mlc::String(to)).as_std_string() != expected) all_match = false;
+                  if (mlc::String(text).replace(mlc::String(from), mlc::String(to)).as_std_string() != expected) all_match = false;
+              }
+      CHECK(all_match); }
+    std::cout << "\n";
+
+    SECTION("repeat, SSO and heap");
+    { CHECK(mlc::String("ab").repeat(3).as_std_string() == "ababab");
+      CHECK(mlc::String("ab").repeat(0).is_empty());
+      mlc::String heap = mlc::String("0123456789").repeat(5);
+      CHECK(heap.byte_size() == 50);
+      CHECK(!heap.is_sso());
+      CHECK(std::move(heap).repeat(3).as_std_string() == std::string(mlc::String("0123456789").repeat(15).view())); }
+    std::cout << "\n";
+}
+
+// ── 16. utf8_from_code_point ─────────────────────────────────────────────────
+
+void test_utf8_from_code_point() {
+    SECTION("ASCII, two-, three- and four-byte code points");
+    CHECK(mlc::utf8_from_code_point(0x41) == mlc::String("A"));
+    CHECK(mlc::utf8_from_code_point(0xE9) == mlc::String("\xC3\xA9"));
+    CHECK(mlc::utf8_from_code_point(0x20AC) == mlc::String("\xE2\x82\xAC"));
+    CHECK(mlc::utf8_from_code_point(0x1F600) == mlc::String("\xF0\x9F\x98\x80"));
+    std::cout << "\n";
+
+    SECTION("lone surrogates and out-of-range values become U+FFFD");
+    CHECK(mlc::utf8_from_code_point(0xD800) == mlc::String("\xEF\xBF\xBD"));
+    CHECK(mlc::utf8_from_code_point(0x110000) == mlc::String("\xEF\xBF\xBD"));
+    CHECK(mlc::utf8_from_code_point(-1) == mlc::String("\xEF\xBF\xBD"));
+    std::cout << "\n";
+}
+
+// ── 17. cached hash ──────────────────────────────────────────────────────────
+
+void test_hash_cache() {
+    SECTION("hash matches std::hash for SSO and heap strings");
+    { mlc::String small("ident");
+      mlc::String large("a_long_identifier_name_on_the_heap");
+      CHECK(small.hash() == std::hash<std::string_view>{}(small.view()));
+      CHECK(large.hash() == std::hash<std::string_view>{}(large.view()));
+      CHECK(large.hash() == large.hash()); }
+    std::cout << "\n";
+
+    SECTION("copies share the cached hash and compare equal");
+    { mlc::String original("another_identifier_longer_than_sso");
+      mlc::String copy = original;
+      CHECK(copy.hash() == original.hash());
+      CHECK(copy == original);
+      CHECK(!(copy != original)); }
+    std::cout << "\n";
+
+    SECTION("in-place append resets the cached hash");
+    { mlc::String grown(std::string(30, 'g'));
+      const size_t before = grown.hash();
+      grown += mlc::String("tail");
+      CHECK(grown.hash() == std::hash<std::string_view>{}(grown.view()));
+      CHECK(grown.hash() != before); }
+    std::cout << "\n";
+
+    SECTION("string_hash_i32 folds the cached hash to a non-negative int32");
+    { mlc::String first("an_identifier_used_as_a_map_key");
+      mlc::String second = mlc::String("an_identifier_used_as_") + mlc::String("a_map_key");
+      CHECK(mlc::string_hash_i32(first) >= 0);
+      CHECK(mlc::string_hash_i32(first) == mlc::string_hash_i32(second));
+      CHECK(mlc::string_hash_i32(mlc::String("x")) >= 0);
+      auto bound = static_cast<int (*)(mlc::String)>(&mlc::string_hash_i32);
+      CHECK(bound(first) == mlc::string_hash_i32(second)); }
+    std::cout << "\n";
+}
+
+// ── 18. string_digest_hex ────────────────────────────────────────────────────
+
+void test_string_digest() {
+    SECTION("FNV-1a 64 (published vectors)");
+    CHECK(mlc::string_digest_hex(mlc::String("")) == mlc::String("cbf29ce484222325"));
+    CHECK(mlc::string_digest_hex(mlc::String("a")) == mlc::String("af63dc4c8601ec8c"));
+    CHECK(mlc::string_digest_hex(mlc::String("export fn a() -> i32 = 1\n"))
+          != mlc::string_digest_hex(mlc::String("export fn a() -> i32 = 2\n")));
+    auto bound = static_cast<mlc::String (*)(mlc::String)>(&mlc::string_digest_hex);
+    CHECK(bound(mlc::String("a")) == mlc::String("af63dc4c8601ec8c"));
+    std::cout << "\n";
+}
+
 // ── main ──────────────────────────────────────────────────────────────────────
 
 int main() {
@@ -368,6 +567,24 @@ int main() {
     std::cout << "12. to_i():\n";
     test_to_i();
 
+    std::cout << "13. operator+= in place:\n";
+    test_append_in_place();
+
+    std::cout << "14. StringBuilder:\n";
+    test_string_builder();
+
+    std::cout << "15. replace/repeat in place:\n";
+    test_replace_repeat_in_place();
+
+    std::cout << "16. utf8_from_code_point:\n";
+    test_utf8_from_code_point();
+
+    std::cout << "17. cached hash:\n";
+    test_hash_cache();
+
+    std::cout << "18. string_digest_hex:\n";
+    test_string_digest();
+
     std::cout << "\n";
     if (failed == 0) {
         std::cout << "ALL " << passed << " checks PASSED\n";
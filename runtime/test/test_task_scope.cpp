@@ -2,6 +2,7 @@
 // g++ -std=c++20 -pthread -I../include -o test_task_scope test_task_scope.cpp
 
 #include "mlc/concurrency/task_scope.hpp"
+#include <stdexcept>
 #include <atomic>
 #include <chrono>
 #include <iostream>
@@ -70,11 +71,72 @@ void test_destructor_requests_cancel() {
     CHECK(saw_cancel.load());
 }
 
+void test_pool_backed_scope() {
+    mlc::concurrency::ThreadPool pool(2, 4, mlc::concurrency::PoolScheduling::WorkStealing);
+    std::atomic<int> counter{0};
+    std::atomic<bool> saw_cancel{false};
+    {
+        mlc::concurrency::TaskScope scope(pool);
+        for (int index = 0; index < 100; ++index) scope.spawn([&] { counter.fetch_add(1); });
+        scope.spawn_with_token([&](mlc::concurrency::StopToken token) {
+            while (!token.requested()) std::this_thread::yield();
+            saw_cancel.store(true);
+        });
+        scope.request_cancel();
+    }
+    CHECK(counter.load() == 100);
+    CHECK(saw_cancel.load());
+    bool rethrown = false;
+    try {
+        mlc::concurrency::TaskScope scope(pool);
+        scope.spawn([] { throw std::runtime_error("child"); });
+        scope.join();
+    } catch (const std::runtime_error&) {
+        rethrown = true;
+    }
+    CHECK(rethrown);
+    // A failing child does not cut the join short: its siblings still finish.
+    std::atomic<int> siblings{0};
+    rethrown = false;
+    try {
+        mlc::concurrency::TaskScope scope(pool);
+        scope.spawn([] { throw std::runtime_error("first"); });
+        for (int index = 0; index < 10; ++index) scope.spawn([&] { siblings.fetch_add(1); });
+        scope.join();
+    } catch (const std::runtime_error&) {
+        rethrown = true;
+    }
+    CHECK(rethrown);
+    CHECK(siblings.load() == 10);
+    pool.shutdown();
+    // A shut-down pool refuses the child; it runs inline instead of being lost.
+    mlc::concurrency::TaskScope late(pool);
+    late.spawn([&] { counter.fetch_add(1); });
+    late.join();
+    CHECK(counter.load() == 101);
+}
+
+// Default scopes share the runtime executor: many short children reuse its
+// workers instead of one thread each.
+void test_default_scope_uses_runtime_executor() {
+    std::atomic<int> counter{0};
+    {
+        mlc::concurrency::TaskScope scope;
+        for (int index = 0; index < 2000; ++index) scope.spawn([&] { counter.fetch_add(1); });
+    }
+    CHECK(counter.load() == 2000);
+    auto& executor = mlc::concurrency::runtime_executor();
+    CHECK(executor.scheduling() == mlc::concurrency::PoolScheduling::WorkStealing);
+    CHECK(executor.worker_count() <= mlc::concurrency::kRuntimeExecutorMaxWorkers);
+}
+
 int main() {
     test_spawn_join_runs_children();
     test_destructor_joins_without_explicit_join();
     test_cancel_reaches_spawn_with_token();
     test_destructor_requests_cancel();
+    test_pool_backed_scope();
+    test_default_scope_uses_runtime_executor();
     if (failed == 0) {
         std::cout << "ALL " << passed << " checks PASSED\n";
     } else {
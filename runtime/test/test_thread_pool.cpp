@@ -1,13 +1,20 @@
-// ThreadPool smoke (TRACK_CONCURRENCY_ISOLATE STEP=1).
+// ThreadPool smoke (TRACK_CONCURRENCY_ISOLATE STEP=1); contract cases run in
+// both SharedQueue and WorkStealing modes.
 // g++ -std=c++20 -pthread -I../include -o test_thread_pool test_thread_pool.cpp
 
 #include "mlc/concurrency/thread_pool.hpp"
 
+#include "mlc/concurrency/task_scope.hpp"
+
 #include <atomic>
 #include <chrono>
 #include <iostream>
+#include <set>
+#include <stdexcept>
 #include <thread>
 
+using mlc::concurrency::PoolScheduling;
+
 static int passed = 0;
 static int failed = 0;
 
@@ -16,10 +23,10 @@ static int failed = 0;
     else { ++failed; std::cerr << "FAIL: " #expression " at line " << __LINE__ << "\n"; } \
 } while(0)
 
-void test_submit_runs_on_workers() {
+void test_submit_runs_on_workers(PoolScheduling scheduling) {
     std::atomic<int> counter{0};
     {
-        mlc::concurrency::ThreadPool pool(4, 16);
+        mlc::concurrency::ThreadPool pool(4, 16, scheduling);
         for (int index = 0; index < 40; ++index) {
             CHECK(pool.submit([&] { counter.fetch_add(1); }));
         }
@@ -28,10 +35,10 @@ void test_submit_runs_on_workers() {
     CHECK(counter.load() == 40);
 }
 
-void test_destructor_drains_queued_jobs() {
+void test_destructor_drains_queued_jobs(PoolScheduling scheduling) {
     std::atomic<int> counter{0};
     {
-        mlc::concurrency::ThreadPool pool(2, 8);
+        mlc::concurrency::ThreadPool pool(2, 8, scheduling);
         for (int index = 0; index < 20; ++index) {
             CHECK(pool.submit([&] {
                 std::this_thread::sleep_for(std::chrono::milliseconds(1));
@@ -42,17 +49,17 @@ void test_destructor_drains_queued_jobs() {
     CHECK(counter.load() == 20);
 }
 
-void test_submit_after_shutdown_fails() {
-    mlc::concurrency::ThreadPool pool(1, 4);
+void test_submit_after_shutdown_fails(PoolScheduling scheduling) {
+    mlc::concurrency::ThreadPool pool(1, 4, scheduling);
     pool.shutdown();
     CHECK(!pool.submit([] {}));
     CHECK(pool.is_shutdown());
 }
 
-void test_full_queue_blocks_until_worker_drains() {
+void test_full_queue_blocks_until_worker_drains(PoolScheduling scheduling) {
     std::atomic<int> started{0};
     std::atomic<int> finished{0};
-    mlc::concurrency::ThreadPool pool(1, 1);
+    mlc::concurrency::ThreadPool pool(1, 1, scheduling);
     CHECK(pool.submit([&] {
         started.store(1);
         std::this_thread::sleep_for(std::chrono::milliseconds(40));
@@ -74,9 +81,9 @@ void test_full_queue_blocks_until_worker_drains() {
     CHECK(third_done.load());
 }
 
-void test_cancel_unblocks_blocked_submit() {
+void test_cancel_unblocks_blocked_submit(PoolScheduling scheduling) {
     std::atomic<bool> worker_busy{false};
-    mlc::concurrency::ThreadPool pool(1, 1);
+    mlc::concurrency::ThreadPool pool(1, 1, scheduling);
     CHECK(pool.submit([&] {
         worker_busy.store(true);
         while (!pool.cancel_requested()) {
@@ -100,9 +107,9 @@ void test_cancel_unblocks_blocked_submit() {
     pool.shutdown();
 }
 
-void test_submit_with_token_sees_cancel() {
+void test_submit_with_token_sees_cancel(PoolScheduling scheduling) {
     std::atomic<bool> saw_cancel{false};
-    mlc::concurrency::ThreadPool pool(1, 4);
+    mlc::concurrency::ThreadPool pool(1, 4, scheduling);
     CHECK(pool.submit_with_token([&](mlc::concurrency::StopToken token) {
         while (!token.requested()) {
             std::this_thread::sleep_for(std::chrono::milliseconds(1));
@@ -115,13 +122,153 @@ void test_submit_with_token_sees_cancel() {
     CHECK(saw_cancel.load());
 }
 
+// Jobs submitted from a worker go to its deque; all of them run, and an
+// external submitter still gets through the injection queue meanwhile.
+void test_worker_submits_stay_local() {
+    std::atomic<int> counter{0};
+    std::atomic<bool> all_local{true};
+    {
+        mlc::concurrency::ThreadPool pool(4, 4, PoolScheduling::WorkStealing);
+        CHECK(pool.scheduling() == PoolScheduling::WorkStealing);
+        CHECK(!pool.on_worker_thread());
+        CHECK(pool.submit([&] {
+            for (int index = 0; index < 1000; ++index) {
+                // More than the injection queue holds: a blocking path would deadlock.
+                if (!pool.submit([&] { counter.fetch_add(1); })) all_local.store(false);
+            }
+        }));
+        CHECK(pool.submit([&] { counter.fetch_add(1); }));
+        while (counter.load() < 1001) std::this_thread::yield();
+    }
+    CHECK(counter.load() == 1001);
+    CHECK(all_local.load());
+}
+
+// Recursive fork/join nested far deeper than the worker count: join() must
+// help run children instead of parking the worker.
+static long parallel_sum(mlc::concurrency::ThreadPool& pool, long low, long high) {
+    if (high - low <= 64) {
+        long sum = 0;
+        for (long value = low; value < high; ++value) sum += value;
+        return sum;
+    }
+    const long middle = low + (high - low) / 2;
+    long left = 0;
+    long right = 0;
+    {
+        mlc::concurrency::TaskScope scope(pool);
+        scope.spawn([&] { left = parallel_sum(pool, low, middle); });
+        scope.spawn([&] { right = parallel_sum(pool, middle, high); });
+    }
+    return left + right;
+}
+
+void test_nested_fork_join_on_two_workers() {
+    mlc::concurrency::ThreadPool pool(2, 8, PoolScheduling::WorkStealing);
+    long result = -1;
+    std::atomic<bool> done{false};
+    CHECK(pool.submit([&] {
+        result = parallel_sum(pool, 0, 100000);
+        done.store(true);
+    }));
+    while (!done.load()) std::this_thread::yield();
+    CHECK(result == 100000L * 99999L / 2);
+    // From a non-worker thread the scope helps through steal/injection too.
+    CHECK(parallel_sum(pool, 0, 5000) == 5000L * 4999L / 2);
+}
+
+void test_help_one_runs_pending_job() {
+    mlc::concurrency::ThreadPool shared(1, 4);
+    CHECK(!shared.help_one());
+    mlc::concurrency::ThreadPool pool(1, 4, PoolScheduling::WorkStealing);
+    std::atomic<bool> release{false};
+    std::atomic<bool> ran{false};
+    CHECK(pool.submit([&] {
+        while (!release.load()) std::this_thread::yield();
+    }));
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    CHECK(pool.submit([&] { ran.store(true); }));
+    std::set<std::thread::id> runners;
+    while (!ran.load()) {
+        if (pool.help_one()) runners.insert(std::this_thread::get_id());
+    }
+    CHECK(runners.count(std::this_thread::get_id()) == 1);
+    release.store(true);
+    pool.shutdown();
+}
+
+// Cancel refuses worker-local submits too; work already in deques still drains.
+void test_shutdown_drains_deques() {
+    std::atomic<int> counter{0};
+    std::atomic<bool> refused{false};
+    {
+        mlc::concurrency::ThreadPool pool(2, 4, PoolScheduling::WorkStealing);
+        CHECK(pool.submit([&] {
+            for (int index = 0; index < 50; ++index) pool.submit([&] { counter.fetch_add(1); });
+            while (!pool.cancel_requested()) std::this_thread::yield();
+            refused.store(!pool.submit([&] { counter.fetch_add(100); }));
+        }));
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    CHECK(counter.load() == 50);
+    CHECK(refused.load());
+}
+
+// Every worker blocks until a job queued behind them runs: only growth helps.
+void test_elastic_pool_grows_when_all_workers_block() {
+    mlc::concurrency::ThreadPool pool(1, 16, PoolScheduling::WorkStealing, 4);
+    CHECK(pool.worker_count() == 1);
+    CHECK(pool.max_worker_count() == 4);
+    std::atomic<bool> released{false};
+    std::atomic<int> unblocked{0};
+    for (int index = 0; index < 3; ++index) {
+        CHECK(pool.submit([&] {
+            while (!released.load()) std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            unblocked.fetch_add(1);
+        }));
+    }
+    CHECK(pool.submit([&] { released.store(true); }));
+    while (unblocked.load() < 3) std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    CHECK(pool.worker_count() >= 2);
+    CHECK(pool.worker_count() <= 4);
+    pool.shutdown();
+    bool rejected = false;
+    try {
+        mlc::concurrency::ThreadPool shared(1, 4, PoolScheduling::SharedQueue, 4);
+    } catch (const std::invalid_argument&) {
+        rejected = true;
+    }
+    CHECK(rejected);
+}
+
+void test_unbounded_queue_never_blocks_submit() {
+    std::atomic<bool> released{false};
+    std::atomic<int> counter{0};
+    mlc::concurrency::ThreadPool pool(1, mlc::concurrency::UnboundedChannelTag{});
+    CHECK(pool.submit([&] {
+        while (!released.load()) std::this_thread::yield();
+    }));
+    for (int index = 0; index < 5000; ++index) CHECK(pool.submit([&] { counter.fetch_add(1); }));
+    released.store(true);
+    pool.shutdown();
+    CHECK(counter.load() == 5000);
+}
+
 int main() {
-    test_submit_runs_on_workers();
-    test_destructor_drains_queued_jobs();
-    test_submit_after_shutdown_fails();
-    test_full_queue_blocks_until_worker_drains();
-    test_cancel_unblocks_blocked_submit();
-    test_submit_with_token_sees_cancel();
+    for (PoolScheduling scheduling : {PoolScheduling::SharedQueue, PoolScheduling::WorkStealing}) {
+        test_submit_runs_on_workers(scheduling);
+        test_destructor_drains_queued_jobs(scheduling);
+        test_submit_after_shutdown_fails(scheduling);
+        test_full_queue_blocks_until_worker_drains(scheduling);
+        test_cancel_unblocks_blocked_submit(scheduling);
+        test_submit_with_token_sees_cancel(scheduling);
+    }
+    test_worker_submits_stay_local();
+    test_nested_fork_join_on_two_workers();
+    test_help_one_runs_pending_job();
+    test_shutdown_drains_deques();
+    test_elastic_pool_grows_when_all_workers_block();
+    test_unbounded_queue_never_blocks_submit();
     if (failed == 0) {
         std::cout << "ALL " << passed << " checks PASSED\n";
     } else {
@@ -1,11 +1,247 @@
-// TRACK_MLC_SCRIPT_VM §103i — host C++ links embedding ABI (call add1 → 42).
+// TRACK_MLC_SCRIPT_VM §103i — host C++ links embedding ABI (call add1 → 42),
+// then diffs the native threaded backend against MLC emb_call_export_ptr.
 #include "mlc/script_vm/embedding_abi.h"
 #include "mlc/script_vm/value_rep_abi.hpp"
 
+#include "embedding.hpp"
+
 #include <cstdio>
 #include <cstdint>
+#include <limits>
+#include <string>
 #include <vector>
 
+namespace {
+
+using mlc::script_vm::encode_int32;
+
+struct BlobProto {
+  std::int32_t register_count;
+  std::vector<std::int32_t> words;
+  std::vector<std::int64_t> constants;
+};
+
+std::int32_t word(std::int32_t opcode, std::int32_t a, std::int32_t b, std::int32_t c) {
+  return (opcode & 255) | ((a & 255) << 8) | ((b & 255) << 16) | ((c & 255) << 24);
+}
+
+// Narrow i16 jump offset packed in B (high) / C (low).
+std::int32_t jump_word(std::int32_t opcode, std::int32_t a, std::int32_t offset) {
+  const std::int32_t masked = offset & 65535;
+  return word(opcode, a, (masked >> 8) & 255, masked & 255);
+}
+
+void append_u32(std::vector<std::uint8_t>& bytes, std::int32_t value) {
+  for (int shift = 0; shift < 32; shift += 8) {
+    bytes.push_back(static_cast<std::uint8_t>((static_cast<std::uint32_t>(value) >> shift) & 255));
+  }
+}
+
+std::vector<std::uint8_t> module_blob(const std::string& export_name,
+                                      const std::vector<BlobProto>& protos) {
+  std::vector<std::uint8_t> bytes;
+  append_u32(bytes, 1129531469);
+  append_u32(bytes, 1);
+  append_u32(bytes, 1);
+  append_u32(bytes, static_cast<std::int32_t>(export_name.size()));
+  bytes.insert(bytes.end(), export_name.begin(), export_name.end());
+  append_u32(bytes, 0);
+  append_u32(bytes, static_cast<std::int32_t>(protos.size()));
+  for (const auto& proto : protos) {
+    append_u32(bytes, proto.register_count);
+    append_u32(bytes, static_cast<std::int32_t>(proto.words.size()));
+    for (const auto value : proto.words) {
+      append_u32(bytes, value);
+    }
+    append_u32(bytes, static_cast<std::int32_t>(proto.constants.size()));
+    for (const auto constant : proto.constants) {
+      for (int shift = 0; shift < 64; shift += 8) {
+        bytes.push_back(
+            static_cast<std::uint8_t>((static_cast<std::uint64_t>(constant) >> shift) & 255));
+      }
+    }
+  }
+  return bytes;
+}
+
+struct DiffCase {
+  const char* label;
+  std::vector<std::uint8_t> blob;
+  std::vector<std::int64_t> args;
+  std::int32_t expected_code;
+  std::int64_t expected_raw;
+};
+
+// sum = 0; while !(n <= 0) { sum += n; n -= 1 }; return sum
+DiffCase loop_case(std::int32_t n) {
+  BlobProto entry{4, {}, {encode_int32(0), encode_int32(1)}};
+  entry.words = {
+      word(1, 1, 0, 0),        // 0: sum = 0
+      word(1, 2, 1, 0),        // 1: one = 1
+      word(1, 3, 0, 0),        // 2: zero = 0
+      word(13, 3, 0, 3),       // 3: r3 = n <= 0
+      word(9, 3, 0, 1), 1,     // 4: wide jump_if_false r3 → 7
+      word(7, 1, 0, 0),        // 6: return sum
+      word(1, 3, 0, 0),        // 7: zero = 0
+      word(3, 1, 1, 0),        // 8: sum += n
+      word(4, 0, 0, 2),        // 9: n -= 1
+      jump_word(8, 0, -8),     // 10: back to 3
+  };
+  const std::int64_t expected = static_cast<std::int64_t>(n) * (n + 1) / 2;
+  return DiffCase{"loop", module_blob("entry", {entry}), {encode_int32(n)}, 0,
+                  encode_int32(static_cast<std::int32_t>(expected))};
+}
+
+// entry(x) = (fn (y) = y + y)(x)
+DiffCase call_case() {
+  BlobProto entry{3, {}, {}};
+  entry.words = {
+      word(23, 1, 1, 0),  // r1 = closure(proto 1)
+      word(2, 2, 0, 0),   // r2 = x
+      word(22, 0, 1, 1),  // r0 = r1(r2)
+      word(7, 0, 0, 0),
+  };
+  BlobProto twice{1, {word(3, 0, 0, 0), word(7, 0, 0, 0)}, {}};
+  return DiffCase{"call", module_blob("entry", {entry, twice}), {encode_int32(21)}, 0,
+                  encode_int32(42)};
+}
+
+// entry(x): captured = x; f = closure reading captured via upvalue; return f()
+DiffCase upvalue_case() {
+  BlobProto entry{3, {}, {}};
+  entry.words = {
+      word(23, 1, 1, 1),
+      (1 << 8) | 0,       // upvalue 0 ← local r0
+      word(22, 2, 1, 0),  // r2 = r1()
+      word(7, 2, 0, 0),
+  };
+  BlobProto reader{1, {word(24, 0, 0, 0), word(7, 0, 0, 0)}, {}};
+  return DiffCase{"upvalue", module_blob("entry", {entry, reader}), {encode_int32(7)}, 0,
+                  encode_int32(7)};
+}
+
+// sum = 0; while !(n <= 0) { f = closure capturing n; sum += f(); n -= 1 }; return sum
+// Two young objects per iteration, so n > 2048 crosses the nursery limit.
+DiffCase closure_churn_case(std::int32_t n) {
+  BlobProto entry{6, {}, {encode_int32(0), encode_int32(1)}};
+  entry.words = {
+      word(1, 1, 0, 0),        // 0: sum = 0
+      word(1, 2, 1, 0),        // 1: one = 1
+      word(1, 3, 0, 0),        // 2: zero = 0
+      word(13, 3, 0, 3),       // 3: r3 = n <= 0
+      word(9, 3, 0, 1), 1,     // 4: wide jump_if_false r3 → 7
+      word(7, 1, 0, 0),        // 6: return sum
+      word(23, 4, 1, 1),       // 7: r4 = closure(proto 1)
+      (1 << 8) | 0,            //    upvalue 0 ← local r0
+      word(22, 5, 4, 0),       // 9: r5 = r4()
+      word(3, 1, 1, 5),        // 10: sum += r5
+      word(4, 0, 0, 2),        // 11: n -= 1
+      jump_word(8, 0, -11),    // 12: back to 2
+  };
+  BlobProto reader{1, {word(24, 0, 0, 0), word(7, 0, 0, 0)}, {}};
+  const std::int64_t expected = static_cast<std::int64_t>(n) * (n + 1) / 2;
+  return DiffCase{"closure_churn", module_blob("entry", {entry, reader}), {encode_int32(n)}, 0,
+                  encode_int32(static_cast<std::int32_t>(expected))};
+}
+
+DiffCase overflow_case() {
+  BlobProto entry{2, {word(1, 1, 0, 0), word(3, 0, 0, 1), word(7, 0, 0, 0)}, {encode_int32(1)}};
+  return DiffCase{"overflow", module_blob("entry", {entry}),
+                  {encode_int32(std::numeric_limits<std::int32_t>::max())}, 3, 0};
+}
+
+// self(self) recurses until the 256-frame limit.
+DiffCase stack_case() {
+  BlobProto entry{2, {word(23, 0, 1, 0), word(2, 1, 0, 0), word(22, 0, 0, 1), word(7, 0, 0, 0)},
+                  {}};
+  BlobProto self{2, {word(2, 1, 0, 0), word(22, 0, 0, 1), word(7, 0, 0, 0)}, {}};
+  return DiffCase{"stack", module_blob("entry", {entry, self}), {}, 5, 0};
+}
+
+// MUL verifies but is outside the program subset → unsupported_opcode → emb_type.
+DiffCase unsupported_case() {
+  BlobProto entry{1, {word(5, 0, 0, 0), word(7, 0, 0, 0)}, {}};
+  return DiffCase{"unsupported", module_blob("entry", {entry}), {encode_int32(3)}, 3, 0};
+}
+
+DiffCase fall_off_case() {
+  BlobProto entry{1, {word(2, 0, 0, 0)}, {}};
+  return DiffCase{"no_return", module_blob("entry", {entry}), {}, 3, 0};
+}
+
+bool run_diff_case(const DiffCase& diff) {
+  MlcVm* vm = mlc_vm_create(nullptr);
+  const MlcResult loaded = mlc_vm_load_module(vm, "diff", diff.blob.data(), diff.blob.size());
+  if (loaded.code != 0) {
+    std::fprintf(stderr, "[embedding_abi_host] FAIL: %s load code=%d\n", diff.label, loaded.code);
+    mlc_vm_destroy(vm);
+    return false;
+  }
+  const MlcHandle handle = mlc_vm_get_export(vm, "diff", "entry");
+  std::vector<MlcValue> args;
+  for (const auto raw : diff.args) {
+    args.push_back(MlcValue{raw});
+  }
+  MlcValue native_value{};
+  const MlcResult native = mlc_vm_call(vm, handle, args.data(), args.size(), &native_value);
+  mlc_handle_release(vm, handle);
+  mlc_vm_destroy(vm);
+
+  std::int64_t reference_raw = 0;
+  const std::int32_t reference_code = embedding::emb_call_export_ptr(
+      reinterpret_cast<std::int64_t>(diff.blob.data()),
+      static_cast<std::int32_t>(diff.blob.size()),
+      mlc::String("entry"),
+      reinterpret_cast<std::int64_t>(diff.args.data()),
+      static_cast<std::int32_t>(diff.args.size()),
+      reinterpret_cast<std::int64_t>(&reference_raw));
+
+  if (native.code != diff.expected_code || reference_code != diff.expected_code) {
+    std::fprintf(stderr, "[embedding_abi_host] FAIL: %s code native=%d reference=%d expected=%d\n",
+                 diff.label, native.code, reference_code, diff.expected_code);
+    return false;
+  }
+  if (diff.expected_code == 0 &&
+      (native_value.raw != diff.expected_raw || reference_raw != diff.expected_raw)) {
+    std::fprintf(stderr, "[embedding_abi_host] FAIL: %s raw native=%lld reference=%lld\n",
+                 diff.label, static_cast<long long>(native_value.raw),
+                 static_cast<long long>(reference_raw));
+    return false;
+  }
+  return true;
+}
+
+// 5000 closures + 5000 cells: two minor collections, one barrier per upvalue store.
+bool run_heap_stats_check() {
+  const DiffCase churn = closure_churn_case(5000);
+  MlcVm* vm = mlc_vm_create(nullptr);
+  mlc_vm_load_module(vm, "churn", churn.blob.data(), churn.blob.size());
+  const MlcHandle handle = mlc_vm_get_export(vm, "churn", "entry");
+  const MlcValue arg{churn.args[0]};
+  MlcValue value{};
+  const MlcResult called = mlc_vm_call(vm, handle, &arg, 1, &value);
+  MlcVmHeapStats stats{};
+  const MlcResult queried = mlc_vm_heap_stats(vm, &stats);
+  mlc_handle_release(vm, handle);
+  mlc_vm_destroy(vm);
+  if (called.code != 0 || queried.code != 0 || stats.calls != 1 ||
+      stats.allocated_objects != 10000 || stats.allocated_bytes != 5000 * (64 + 32) ||
+      stats.minor_collections != 2 || stats.write_barrier_hits != 10000 ||
+      stats.gc_pause_max_us > stats.gc_pause_total_us) {
+    std::fprintf(stderr,
+                 "[embedding_abi_host] FAIL: heap_stats objects=%llu bytes=%llu minor=%llu "
+                 "barriers=%llu\n",
+                 static_cast<unsigned long long>(stats.allocated_objects),
+                 static_cast<unsigned long long>(stats.allocated_bytes),
+                 static_cast<unsigned long long>(stats.minor_collections),
+                 static_cast<unsigned long long>(stats.write_barrier_hits));
+    return false;
+  }
+  return true;
+}
+
+}  // namespace
+
 int main() {
   std::vector<std::uint8_t> blob(4096);
   const size_t needed = mlc_script_vm_fixture_add1(blob.data(), blob.size());
@@ -62,8 +298,24 @@ int main() {
   mlc_handle_release(vm, handle);
   mlc_vm_destroy(vm);
 
+  const DiffCase diff_cases[] = {
+      loop_case(1000), call_case(),        upvalue_case(),  overflow_case(),
+      stack_case(),    unsupported_case(), fall_off_case(), closure_churn_case(5000),
+  };
+  for (const auto& diff : diff_cases) {
+    if (!run_diff_case(diff)) {
+      return 8;
+    }
+  }
+
+  if (!run_heap_stats_check()) {
+    return 9;
+  }
+
   std::printf("host_call=ok\n");
   std::printf("add1=ok\n");
+  std::printf("threaded_diff=ok\n");
+  std::printf("heap_stats=ok\n");
   std::printf("[script_vm] embedding_abi_host ok\n");
   return 0;
 }
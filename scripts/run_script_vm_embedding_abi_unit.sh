@@ -9,6 +9,7 @@ ENTRY="$ROOT_DIR/script_vm/tests/embedding_abi_unit.mlc"
 EMBEDDING="$ROOT_DIR/script_vm/embedding.mlc"
 HOST="$ROOT_DIR/script_vm/tests/embedding_abi_host.cpp"
 BRIDGE="$ROOT_DIR/runtime/src/script_vm/embedding_abi.cpp"
+THREADED="$ROOT_DIR/runtime/src/script_vm/threaded_dispatch.cpp"
 HEADER="$ROOT_DIR/runtime/include/mlc/script_vm/embedding_abi.h"
 RED="$ROOT_DIR/scripts/run_script_vm_embedding_abi_unit_red.sh"
 CLOSURES_UNIT="$ROOT_DIR/scripts/run_script_vm_closures_fibers_unit.sh"
@@ -30,6 +31,7 @@ fail() {
 [ -f "$EMBEDDING" ] || fail "missing embedding.mlc"
 [ -f "$HOST" ] || fail "missing host"
 [ -f "$BRIDGE" ] || fail "missing bridge"
+[ -f "$THREADED" ] || fail "missing threaded dispatch"
 [ -f "$HEADER" ] || fail "missing embedding_abi.h"
 [ -f "$RED" ] || fail "missing red harness"
 
@@ -60,9 +62,10 @@ printf '%s\n' "$unit_output" | grep -q '\[script_vm\] embedding_abi_unit ok' ||
 printf '%s\n' "$unit_output" | grep -q 'embedding_abi=ok' || fail "missing embedding_abi=ok"
 printf '%s\n' "$unit_output" | grep -q 'add1=ok' || fail "missing unit add1=ok"
 
-# Host: mlcc embedding.mlc (no main) + bridge + host.cpp
+# Host: mlcc embedding.mlc (no main) + bridge + threaded backend + host.cpp
 "$MLCC" -o "$HOST_OUT" "$EMBEDDING"
 cp "$BRIDGE" "$HOST_OUT/embedding_abi.cpp"
+cp "$THREADED" "$HOST_OUT/threaded_dispatch.cpp"
 cp "$HOST" "$HOST_OUT/embedding_abi_host.cpp"
 "$COMPILER_DIR/build_bin.sh" "$HOST_OUT" "$HOST_BIN"
 [ -x "$HOST_BIN" ] || fail "missing host binary"
@@ -78,6 +81,8 @@ fi
 printf '%s\n' "$host_output" | grep -q '\[script_vm\] embedding_abi_host ok' || \
   fail "missing embedding_abi_host ok"
 printf '%s\n' "$host_output" | grep -q 'host_call=ok' || fail "missing host_call=ok"
+printf '%s\n' "$host_output" | grep -q 'threaded_diff=ok' || fail "missing threaded_diff=ok"
+printf '%s\n' "$host_output" | grep -q 'heap_stats=ok' || fail "missing heap_stats=ok"
 
 if bash "$RED" >/tmp/script_vm_embedding_abi_red.out 2>&1; then
   fail "red unexpectedly exited 0"
@@ -92,6 +97,8 @@ bash "$CLOSURES_UNIT" >/tmp/script_vm_embedding_abi_closures_side.out 2>&1 || \
   echo "embedding_abi=ok"
   echo "add1=ok"
   echo "host_call=ok"
+  echo "threaded_diff=ok"
+  echo "heap_stats=ok"
   echo "red_already_present=ok"
   echo "side_closures_fibers=ok"
 } | tee "$REPORT_FILE"